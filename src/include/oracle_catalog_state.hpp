@@ -7,11 +7,20 @@
 #include "duckdb/common/types/value.hpp"
 #include "oracle_connection.hpp"
 #include "oracle_settings.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
 #include <string>
 #include <memory>
 
 namespace duckdb {
 
+class DatabaseInstance;
+class OracleMirrorManager;
+
 //! Oracle database version information with feature flags
 struct OracleVersionInfo {
 	int major = 0;
@@ -22,12 +31,74 @@ struct OracleVersionInfo {
 	bool supports_vector_serialize = false; // Oracle 23.4+ has VECTOR_SERIALIZE function
 };
 
+//! One ALL_TAB_COLUMNS row, as used to build table entries.
+struct OracleColumnInfo {
+	string name;
+	string data_type;
+	idx_t data_length = 0;
+	idx_t precision = 0;
+	idx_t scale = 0;
+	bool nullable = true;
+};
+
+//! Optimizer statistics for one column from ALL_TAB_COL_STATISTICS.
+struct OracleColumnStatistics {
+	idx_t num_distinct = 0;
+};
+
+//! Optimizer statistics for one table from the Oracle data dictionary.
+struct OracleTableStatistics {
+	//! False when the table has never been analyzed.
+	bool has_row_count = false;
+	idx_t num_rows = 0;
+	unordered_map<string, OracleColumnStatistics> columns;
+	//! Column sets of the table's unique indexes, which back its primary and unique keys.
+	vector<vector<string>> unique_keys;
+};
+
+//! Deduplicates concurrent loads of the same key: the first caller runs the load and every caller that arrives
+//! while it is running waits for, and shares, its result (or exception).
+template <class T>
+class OracleSingleFlight {
+public:
+	T Run(const string &key, const std::function<T()> &load) {
+		std::promise<T> promise;
+		std::shared_future<T> pending;
+		bool leader = false;
+		{
+			lock_guard<std::mutex> guard(lock);
+			auto entry = calls.find(key);
+			if (entry != calls.end()) {
+				pending = entry->second;
+			} else {
+				pending = promise.get_future().share();
+				calls.emplace(key, pending);
+				leader = true;
+			}
+		}
+		if (leader) {
+			try {
+				promise.set_value(load());
+			} catch (...) {
+				promise.set_exception(std::current_exception());
+			}
+			lock_guard<std::mutex> guard(lock);
+			calls.erase(key);
+		}
+		return pending.get();
+	}
+
+private:
+	std::mutex lock;
+	unordered_map<string, std::shared_future<T>> calls;
+};
+
 //! Shared state per attached Oracle database used by generators for schemas/tables.
 class OracleCatalogState {
 public:
-	explicit OracleCatalogState(std::string connection_string_p)
-	    : connection_string(std::move(connection_string_p)), connection(make_uniq<OracleConnection>()) {
+	explicit OracleCatalogState(std::string connection_string_p) : connection_string(std::move(connection_string_p)) {
 	}
+	~OracleCatalogState();
 
 	void Connect();
 	OracleResult Query(const std::string &query);
@@ -44,6 +115,7 @@ public:
 	// Current schema detection
 	void DetectCurrentSchema();
 	string GetCurrentSchema() const {
+		lock_guard<std::mutex> guard(lock);
 		return current_schema;
 	}
 
@@ -70,18 +142,112 @@ public:
 	string GetObjectName(const string &schema, const string &object_name, const string &object_types);
 	string GetRealSchemaName(const string &name);
 
+	// Column metadata (cached per table; served from the schema-wide prefetch when metadata_prefetch is set)
+	vector<OracleColumnInfo> GetColumns(const string &schema, const string &table);
+	//! Load columns for every table and view of a schema in a single query (idempotent per schema).
+	void PrefetchSchema(const string &schema);
+
+	//! Drop per-object caches (columns, statistics, DDL times); each ATTACH starts from fresh object metadata.
+	void ResetObjectCaches();
+
+	// Persistent metadata cache (metadata_cache_file option)
+	//! Load the cache file and drop entries whose objects changed according to ALL_OBJECTS.LAST_DDL_TIME.
+	void LoadMetadataCache();
+	//! Write the in-memory metadata caches to the cache file (no-op when the option is unset).
+	void SaveMetadataCache();
+
+	//! Catalog version reported to DuckDB. It changes only on ClearCaches or when DDL is detected in a schema whose
+	//! metadata was loaded (polled at most every ddl_check_interval seconds), so bound plans stay valid otherwise.
+	idx_t GetCatalogVersion();
+	//! Catalog version as of the last DDL check, without polling.
+	idx_t CurrentCatalogVersion() const {
+		return catalog_version;
+	}
+
+	// Dictionary statistics and unique keys (cached until ClearCaches); callers check enable_statistics for their
+	// client context before using the statistics
+	shared_ptr<OracleTableStatistics> GetTableStatistics(const string &schema, const string &table);
+
 	const string connection_string;
 
+	//! Start background mirroring for the mirror_tables option (no-op when unset or already running).
+	void StartMirrors(DatabaseInstance &db);
+	//! Mirror manager, or nullptr when no tables are mirrored.
+	shared_ptr<OracleMirrorManager> GetMirrors() {
+		lock_guard<std::mutex> guard(lock);
+		return mirrors;
+	}
+
 private:
-	OracleConnection &EnsureConnectionInternal();
-	std::mutex lock;
-	unique_ptr<OracleConnection> connection;
+	//! Per-table caches, sharded by key so binds of different tables do not contend on one mutex.
+	struct CacheShard {
+		std::mutex lock;
+		//! schema.table -> columns in column_id order
+		unordered_map<string, vector<OracleColumnInfo>> columns;
+		unordered_map<string, shared_ptr<OracleTableStatistics>> statistics;
+	};
+	static constexpr idx_t CACHE_SHARD_COUNT = 16;
+	CacheShard &ShardFor(const string &key);
+
+	//! Run one metadata query on a pooled catalog session (at most metadata_connections run concurrently).
+	OracleResult QueryMetadata(const string &query);
+	//! Wait for a free session slot; returns an idle connected session, or nullptr when a new one must be opened.
+	unique_ptr<OracleConnection> BorrowSession(idx_t &epoch);
+	void ReleaseSession(unique_ptr<OracleConnection> session, idx_t epoch);
+
+	void DetectOracleVersionInternal();
+	vector<string> LoadObjects(const string &schema, const string &object_types, const string &cache_key);
+	void PrefetchSchemaInternal(const string &schema);
+	shared_ptr<OracleTableStatistics> LoadTableStatistics(const string &schema, const string &table,
+	                                                      const string &key);
+	unordered_map<string, string> QueryDdlTimes(const string &schema);
+	void TrackDdlTimes(const string &schema);
+	//! Cache file contents (empty when no schema has recorded DDL times).
+	string SerializeMetadataCache();
+	//! Record a DDL baseline for schema before its metadata is first loaded (no-op when polling is off).
+	void WatchSchema(const string &schema);
+	//! UPPER(owner) -> object count and newest LAST_DDL_TIME; schemas without objects are absent.
+	unordered_map<string, string> QuerySchemaSignatures(const vector<string> &schemas);
+	void CheckForDdl();
+
+	//! Protects the schema-level caches below; never held across a round trip to Oracle.
+	mutable std::mutex lock;
 	string current_schema;
 	OracleVersionInfo version_info;
-	bool version_detected = false;
+	std::atomic<bool> version_detected {false};
 	vector<string> schema_cache;
 	unordered_map<string, vector<string>> table_cache;
 	unordered_map<string, vector<string>> object_cache;
+	//! UPPER(schema) -> UPPER(object name) -> object name, for schemas loaded by PrefetchSchema
+	unordered_map<string, unordered_map<string, string>> prefetched_objects;
+	//! UPPER(schema) -> object name -> LAST_DDL_TIME read before that schema's metadata was cached
+	unordered_map<string, unordered_map<string, string>> ddl_times;
+	std::array<CacheShard, CACHE_SHARD_COUNT> shards;
+	//! Bumped by ClearCaches/ResetObjectCaches; loads started under an older generation do not populate caches.
+	std::atomic<idx_t> cache_generation {0};
+
+	// DDL-aware catalog versioning
+	std::atomic<idx_t> catalog_version {0};
+	//! UPPER(schema) -> signature from QuerySchemaSignatures, for every schema whose metadata was loaded
+	unordered_map<string, string> schema_signatures;
+	std::chrono::steady_clock::time_point last_ddl_check;
+
+	// Metadata session pool
+	std::mutex session_lock;
+	std::condition_variable session_cv;
+	vector<unique_ptr<OracleConnection>> idle_sessions;
+	idx_t sessions_in_use = 0;
+	//! Bumped by ClearCaches so sessions borrowed before the reset are not returned to the pool.
+	idx_t session_epoch = 0;
+
+	OracleSingleFlight<vector<string>> list_loads;
+	OracleSingleFlight<vector<OracleColumnInfo>> column_loads;
+	OracleSingleFlight<shared_ptr<OracleTableStatistics>> statistics_loads;
+	OracleSingleFlight<string> name_loads;
+	//! Schema prefetch, DDL time tracking and version detection.
+	OracleSingleFlight<bool> state_loads;
+
+	shared_ptr<OracleMirrorManager> mirrors;
 };
 
 } // namespace duckdb
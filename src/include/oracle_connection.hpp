@@ -9,13 +9,42 @@
 
 namespace duckdb {
 
-struct OracleResult {
+//! Columnar result of OracleConnection::Query. Each column keeps its values back to back in one buffer with an
+//! offset array and a NULL mask, so metadata results with thousands of rows need only a handful of allocations.
+class OracleResult {
+public:
 	std::vector<std::string> columns;
-	std::vector<std::vector<std::string>> rows;
 
+	idx_t RowCount() const;
+	idx_t ColumnCount() const {
+		return columns.size();
+	}
+	const std::string &ColumnName(idx_t col) const;
+
+	bool IsNull(idx_t row, idx_t col) const;
+	//! Value as text; NULL is returned as the empty string (matching Oracle's '' IS NULL semantics).
 	std::string GetString(idx_t row, idx_t col) const;
 	int64_t GetInt64(idx_t row, idx_t col) const;
 	double GetDouble(idx_t row, idx_t col) const;
+
+	//! Builder interface used by OracleConnection::Query.
+	void AddColumn(std::string name);
+	void Append(idx_t col, const char *data, idx_t length);
+	void AppendNull(idx_t col);
+	//! Drop all rows but keep the column list (used when a fetch has to be restarted with wider buffers).
+	void ClearRows();
+
+private:
+	struct ColumnData {
+		std::string values;
+		//! offsets[i] is the start of row i in values; offsets[RowCount()] is the end of the last value.
+		std::vector<idx_t> offsets {0};
+		std::vector<bool> nulls;
+	};
+
+	void CheckIndex(idx_t row, idx_t col) const;
+
+	std::vector<ColumnData> data;
 };
 
 class OracleConnection {
@@ -24,11 +53,20 @@ public:
 	~OracleConnection();
 
 	void Connect(const std::string &connection_string);
+	//! Connect through the session pool using settings' pool limits and health checks.
+	void Connect(const std::string &connection_string, const OracleSettings &settings);
 	bool IsConnected() const;
 
-	//! Execute a query and return all rows as strings (used for metadata discovery).
+	//! Execute a query and return all rows as text (used for metadata discovery). Rows are array-fetched; values
+	//! longer than the described column width are re-fetched with wider buffers instead of being truncated.
 	OracleResult Query(const std::string &query);
 
+	//! Execute a statement that returns no rows (DML, DDL, EXPLAIN PLAN) without committing.
+	void Execute(const std::string &statement);
+
+	//! Read the current database SCN (falls back to TIMESTAMP_TO_SCN without DBMS_FLASHBACK grants).
+	int64_t GetCurrentScn();
+
 	//! Commit the current transaction
 	void Commit();
 
@@ -5,6 +5,8 @@
 #include "duckdb/common/exception.hpp"
 #include "oracle_settings.hpp"
 #include <oci.h>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,6 +16,13 @@
 
 namespace duckdb {
 
+class ClientContext;
+struct OracleConnectionPool;
+
+//! Acquisition class. Interactive work (catalog lookups, binds, DML, EXPLAIN) may use the reserved_connections slots
+//! and goes ahead of queued bulk acquisitions; bulk table scans are capped at bulk_connection_limit.
+enum class OracleAcquirePriority : uint8_t { INTERACTIVE, BULK };
+
 struct OracleContext {
 	OCIEnv *envhp = nullptr;
 	OCIError *errhp = nullptr;
@@ -23,20 +32,59 @@ struct OracleContext {
 	OCIStmt *stmthp = nullptr; // Shared statement handle for some ops
 	bool connected = false;
 	bool owns_env = false;
+	//! Obtained with OCISessionGet: released back to the OCI session pool instead of ended, and never kept idle in
+	//! OracleConnectionPool (the OCI pool, or DRCP on the server, does the pooling).
+	bool session_pooled = false;
+	//! Keeps the owning OCI session pool alive while the session is out.
+	std::shared_ptr<OracleConnectionPool> session_pool_owner;
+	//! Tag of the session-init profile the session carries; session-pooled sessions are retagged with it on release.
+	std::string session_tag;
+	std::chrono::steady_clock::time_point created_at = std::chrono::steady_clock::now();
+	//! When the session was created or last returned to its pool.
+	std::chrono::steady_clock::time_point last_used = created_at;
 
 	~OracleContext();
 };
 
 struct OracleConnectionPool {
+	//! Acquire wait histogram buckets: < 1ms, < 10ms, < 100ms, < 1s, >= 1s.
+	static constexpr idx_t WAIT_BUCKETS = 5;
+
+	~OracleConnectionPool();
+
 	std::mutex lock;
 	std::vector<std::shared_ptr<OracleContext>> idle;
 	idx_t total = 0;
 	idx_t limit = 8;
 	std::condition_variable cv;
+	idx_t bulk_in_use = 0;         // sessions currently held by bulk acquisitions
+	idx_t interactive_waiting = 0; // queued interactive acquisitions; bulk acquisitions yield to them
+
+	// Reported by oracle_pool_stats(); counters are guarded by lock
+	std::string label; // pool key with the password redacted
+	std::string pool_mode;
+	idx_t acquires = 0;
+	idx_t waits = 0; // acquisitions that blocked on cv for a free slot
+	idx_t wait_histogram[WAIT_BUCKETS] = {};
+	idx_t total_wait_us = 0;
+	idx_t timeouts = 0;
+	idx_t creations = 0;
+	idx_t evictions = 0; // sessions closed by health checks (idle/lifetime limits, failed validation, dead server)
+	idx_t failed_logons = 0;
+
+	// OCI session pool backend (pool_mode session_pool/drcp), created on first use
+	std::mutex spool_lock;
+	OCISPool *spoolhp = nullptr;
+	OCIError *spool_errhp = nullptr;
+	OraText *spool_name = nullptr;
+	ub4 spool_name_len = 0;
+	//! sess_max the OCI pool was created or last re-initialized with; grown with connection_limit
+	ub4 spool_max = 0;
 };
 
 struct OracleConnectionHandle {
-	OracleConnectionHandle(std::shared_ptr<OracleConnectionPool> pool, std::shared_ptr<OracleContext> ctx);
+	OracleConnectionHandle(std::shared_ptr<OracleConnectionPool> pool, std::shared_ptr<OracleContext> ctx,
+	                       bool bulk = false);
 	~OracleConnectionHandle();
 
 	std::shared_ptr<OracleContext> Get() {
@@ -46,17 +94,71 @@ struct OracleConnectionHandle {
 private:
 	std::shared_ptr<OracleConnectionPool> pool;
 	std::shared_ptr<OracleContext> ctx;
+	bool bulk = false;
+};
+
+//! Point-in-time copy of one pool's counters.
+struct OracleConnectionPoolStats {
+	std::string pool;
+	std::string pool_mode;
+	idx_t total = 0;
+	idx_t idle = 0;
+	idx_t in_use = 0;
+	idx_t bulk_in_use = 0;
+	idx_t limit = 0;
+	idx_t acquires = 0;
+	idx_t waits = 0;
+	idx_t wait_histogram[OracleConnectionPool::WAIT_BUCKETS] = {};
+	idx_t total_wait_us = 0;
+	idx_t timeouts = 0;
+	idx_t creations = 0;
+	idx_t evictions = 0;
+	idx_t failed_logons = 0;
+};
+
+//! While alive, interrupting the query of `context` breaks the OCI call in flight on the session (OCIBreak from a
+//! watcher thread), so a blocked execute or fetch returns ORA-01013 instead of running to completion. The session is
+//! reset when the guard goes out of scope.
+class OracleInterruptGuard {
+public:
+	OracleInterruptGuard(ClientContext &context, OracleContext &ctx);
+	~OracleInterruptGuard();
+
+	//! Whether the call was broken because the query was interrupted.
+	bool Broken() const;
+
+private:
+	ClientContext &context;
+	OracleContext &ctx;
+	std::atomic<bool> broken {false};
+
+	friend class OracleInterruptWatcher;
 };
 
 class OracleConnectionManager {
 public:
 	static OracleConnectionManager &Instance();
 
-	std::shared_ptr<OracleConnectionHandle> Acquire(const std::string &connection_string,
-	                                                const OracleSettings &settings, idx_t wait_timeout_ms = 10000);
+	//! Longest wait for a session, in the pool's admission queue and in OCISessionGet of session-pooled backends.
+	static constexpr idx_t ACQUIRE_TIMEOUT_MS = 10000;
+
+	std::shared_ptr<OracleConnectionHandle>
+	Acquire(const std::string &connection_string, const OracleSettings &settings,
+	        OracleAcquirePriority priority = OracleAcquirePriority::INTERACTIVE,
+	        idx_t wait_timeout_ms = ACQUIRE_TIMEOUT_MS);
+
+	//! Open sessions until the pool holds settings.min_connections, logging on in parallel. Failures are only
+	//! logged; the first real use reports connection errors.
+	void WarmUp(const std::string &connection_string, const OracleSettings &settings);
 
 	void Clear();
 
+	//! Bulk sessions a pool sized by settings.connection_limit lets one client hold at once.
+	static idx_t BulkSessionLimit(const OracleSettings &settings);
+
+	//! Counters of every pool, for oracle_pool_stats().
+	std::vector<OracleConnectionPoolStats> Stats();
+
 	OCIEnv *Env() {
 		return envhp;
 	}
@@ -69,8 +171,19 @@ private:
 	OracleConnectionManager();
 	~OracleConnectionManager();
 
+	std::shared_ptr<OracleConnectionPool> GetPool(const std::string &connection_string,
+	                                              const OracleSettings &settings);
 	std::shared_ptr<OracleContext> CreateConnection(const std::string &connection_string,
-	                                                const OracleSettings &settings);
+	                                                const OracleSettings &settings,
+	                                                const std::shared_ptr<OracleConnectionPool> &pool);
+	std::shared_ptr<OracleContext> CreatePooledSession(const std::string &connection_string,
+	                                                   const OracleSettings &settings,
+	                                                   const std::shared_ptr<OracleConnectionPool> &pool);
+	void EnsureSessionPool(OracleConnectionPool &pool, const std::string &connection_string,
+	                       const OracleSettings &settings);
+	//! Per-session setup shared by both backends (statement cache, call timeout) plus, when run_profile is set, the
+	//! NLS formats and session_init profile in one round trip.
+	void InitializeSession(OracleContext &ctx, const OracleSettings &settings, bool run_profile);
 };
 
 } // namespace duckdb
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "oracle_settings.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace duckdb {
+
+//! Immutable, DuckDB-native copy of an Oracle table.
+struct OracleMirrorSnapshot {
+	shared_ptr<ColumnDataCollection> data;
+	//! SCN captured before the snapshot was read; every change committed at or before it is contained.
+	int64_t scn = 0;
+	//! Start of the refresh that produced the snapshot (staleness is measured from here).
+	std::chrono::steady_clock::time_point refreshed_at;
+};
+
+//! How to read a mirrored table; registered by OracleTableEntry on its first scan.
+struct OracleMirrorDefinition {
+	string schema_name;
+	string table_name;
+	//! Oracle SELECT list (including type conversions) producing the columns below.
+	string select_list;
+	vector<string> names;
+	vector<LogicalType> types;
+};
+
+//! Keeps DuckDB-native copies of the tables selected by the mirror_tables ATTACH option and refreshes them on a
+//! background thread. Tables with a primary key are refreshed incrementally (ORA_ROWSCN delta merged by key);
+//! others, and any refresh whose merged row count disagrees with Oracle (deletes), are reloaded in full.
+class OracleMirrorManager : public enable_shared_from_this<OracleMirrorManager> {
+public:
+	OracleMirrorManager(string connection_string, const OracleSettings &settings);
+	~OracleMirrorManager();
+
+	//! Whether schema.table was selected by mirror_tables ("TABLE" or "SCHEMA.TABLE", case-insensitive).
+	bool IsMirrored(const string &schema_name, const string &table_name) const;
+	//! Register a table (idempotent); the background thread performs its initial load.
+	void Register(OracleMirrorDefinition definition);
+	//! Snapshot younger than mirror_max_staleness, or nullptr when the caller must scan Oracle live.
+	shared_ptr<OracleMirrorSnapshot> GetFreshSnapshot(const string &schema_name, const string &table_name);
+
+	void Start(DatabaseInstance &db);
+	void Stop();
+
+private:
+	struct MirrorEntry {
+		OracleMirrorDefinition definition;
+		vector<idx_t> key_columns;
+		bool keys_loaded = false;
+		shared_ptr<OracleMirrorSnapshot> snapshot;
+		std::chrono::steady_clock::time_point next_refresh;
+	};
+
+	static string EntryKey(const string &schema_name, const string &table_name);
+	void RefreshLoop();
+	void Refresh(DatabaseInstance &db, MirrorEntry &entry);
+	shared_ptr<ColumnDataCollection> Fetch(DatabaseInstance &db, const OracleMirrorDefinition &definition,
+	                                       const string &oracle_query);
+
+	const string connection_string;
+	const OracleSettings settings;
+	vector<string> patterns;
+
+	std::mutex lock;
+	std::condition_variable cv;
+	unordered_map<string, shared_ptr<MirrorEntry>> entries;
+	weak_ptr<DatabaseInstance> database;
+	std::thread worker;
+	bool stopped = false;
+	//! Context of the connection running a refresh query; Stop interrupts it instead of waiting for a full reload.
+	shared_ptr<ClientContext> active_context;
+};
+
+//! Table function scanning a mirror snapshot; bind_data is set to the snapshot.
+TableFunction OracleMirrorScanFunction(shared_ptr<OracleMirrorSnapshot> snapshot, unique_ptr<FunctionData> &bind_data);
+
+} // namespace duckdb
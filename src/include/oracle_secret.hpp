@@ -11,11 +11,13 @@ namespace duckdb {
 struct OracleSecretParameters {
 	string host = "localhost";
 	idx_t port = 1521;
-	string service;     // Oracle service name (required)
-	string database;    // Alias for service
-	string user;        // Oracle username (required)
-	string password;    // Oracle password (required)
-	string wallet_path; // Optional: path to Oracle Wallet
+	string service;          // Oracle service name (required)
+	string database;         // Alias for service
+	string user;             // Oracle username (required)
+	string password;         // Oracle password (required)
+	string wallet_path;      // Optional: path to Oracle Wallet
+	string pool_mode;        // Optional: dedicated, session_pool or drcp (applied as an ATTACH option)
+	string connection_class; // Optional: DRCP connection class
 };
 
 //! Parse Oracle secret from CreateSecretInput
@@ -28,6 +30,9 @@ void ValidateOracleSecret(const OracleSecretParameters &params);
 //! Returns EZConnect format: user/password@host:port/service
 string BuildConnectionStringFromSecret(const KeyValueSecret &secret);
 
+//! Copy session-backend settings stored in the secret into ATTACH options that were not given explicitly
+void ApplyOracleSecretOptions(const KeyValueSecret &secret, case_insensitive_map_t<Value> &options);
+
 //! Create secret function for Oracle secrets
 unique_ptr<BaseSecret> CreateOracleSecretFromConfig(ClientContext &context, CreateSecretInput &input);
 
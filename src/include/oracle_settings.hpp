@@ -9,11 +9,43 @@ struct OracleSettings {
 	// Enabled by default for performance (industry standard for remote DB connectors)
 	// Disable with SET oracle_enable_pushdown = false for debugging
 	bool enable_pushdown = true;
-	idx_t prefetch_rows = 200;
+	idx_t prefetch_rows = 1024;
 	idx_t prefetch_memory = 0;
 	idx_t array_size = 256;
+	// Adaptive prefetch: size OCI prefetch and the fetch batch per table from the measured row width and round-trip
+	// time, aiming at fetch_target_bytes per round trip (prefetch_memory, or 16MB, caps the prefetch buffer)
+	bool adaptive_prefetch = false;
+	idx_t fetch_target_bytes = 1048576;
+	// Read-ahead: fetch the next batch on a shared I/O thread (at most io_threads fetches in flight) while DuckDB
+	// converts the current one; doubles a scan's define buffers. Speculative executes run on io_threads threads of
+	// their own.
+	bool read_ahead = false;
+	idx_t io_threads = 4;
+	// Speculative execute: open the cursor and fetch the first batch on an I/O thread from OracleInitGlobal
+	bool speculative_execute = false;
+	// Point lookup: catalog-table scans filtered by `=` on a primary or unique key execute and fetch the first batch in
+	// one round trip
+	bool point_lookup = true;
 	bool connection_cache = true;
 	idx_t connection_limit = 8;
+	// Pool health: sessions are pinged on borrow when idle for validation_interval seconds; sessions idle for
+	// max_idle_time or older than max_lifetime seconds are closed (0 = never), keeping at least min_connections.
+	idx_t min_connections = 0;
+	idx_t connection_max_idle_time = 600;
+	idx_t connection_max_lifetime = 0;
+	idx_t connection_validation_interval = 30;
+	// Priority lanes: reserved_connections slots are kept for interactive work (catalog lookups, binds, DML); table
+	// scans acquire as bulk and hold at most bulk_connection_limit sessions (0 = pool limit minus reserved).
+	idx_t reserved_connections = 1;
+	idx_t bulk_connection_limit = 0;
+	string scan_priority = "bulk"; // acquisition class of table scans: "bulk" or "interactive"
+	// Session backend (ATTACH option or secret): "dedicated" (OCIServerAttach + OCISessionBegin per session),
+	// "session_pool" (OCISessionPoolCreate/OCISessionGet) or "drcp" (session pool against a :POOLED server).
+	string pool_mode = "dedicated";
+	string connection_class = "DUCKDB"; // DRCP connection class; sessions are shared within a class
+	// Session-init profile: ';'-separated ALTER SESSION statements and PL/SQL calls, run together with the NLS
+	// setup in one anonymous block at logon. Session-pooled sessions are tagged with the profile and reused as is.
+	string session_init;
 	bool debug_show_queries = false;
 
 	// Advanced features
@@ -21,6 +53,10 @@ struct OracleSettings {
 	string metadata_object_types = "TABLE,VIEW,SYNONYM,MATERIALIZED VIEW";
 	idx_t metadata_result_limit = 10000;
 	bool use_current_schema = true;
+	bool metadata_prefetch = false; // Load all column metadata of a schema in one query (ATTACH option)
+	string metadata_cache_file;     // Persist catalog metadata across processes (ATTACH option, empty = off)
+	idx_t metadata_connections = 4; // Concurrent catalog metadata sessions per attached database (ATTACH option)
+	idx_t ddl_check_interval = 30;  // Seconds between ALL_OBJECTS DDL polls for the catalog version (0 = off)
 
 	// Type conversion settings (for OCI array fetch buffer alignment issues)
 	bool try_native_lobs = true;        // Try native LOB/RAW fetch first, fallback on corruption
@@ -28,6 +64,26 @@ struct OracleSettings {
 	bool vector_to_list = true;         // Parse VECTOR JSON to LIST<FLOAT> (vs raw VARCHAR)
 	bool enable_type_conversion = true; // Enable server-side type conversion for problematic types
 	bool enable_spatial_types = true;   // Map SDO_GEOMETRY to GEOMETRY type (requires spatial extension)
+
+	// Feed ALL_TAB_STATISTICS / ALL_TAB_COL_STATISTICS row and distinct counts to the DuckDB optimizer
+	bool enable_statistics = true;
+	// Ask Oracle's optimizer (EXPLAIN PLAN) for row estimates of queries without dictionary statistics; opt-in, as
+	// each new SQL text costs extra round trips at plan time
+	bool explain_cardinality = false;
+	// Describe results kept per SQL text so repeated oracle_query binds through an attached database skip the describe
+	// round trip (0 = off); opt-in, as a cached result stays stale until the DDL watch notices the change
+	idx_t describe_cache_size = 0;
+
+	// Local mirrors (ATTACH only): comma-separated TABLE or SCHEMA.TABLE names kept as DuckDB-native copies
+	string mirror_tables;
+	idx_t mirror_refresh_interval = 300; // seconds between background refreshes
+	idx_t mirror_max_staleness = 900;    // seconds a mirror may lag before scans fall back to Oracle
 };
 
+class ClientContext;
+class OracleCatalogState;
+
+//! Settings of a client: the attached catalog's options (when state is set) overridden by the oracle_* settings.
+OracleSettings GetOracleSettings(ClientContext &context, OracleCatalogState *state = nullptr);
+
 } // namespace duckdb
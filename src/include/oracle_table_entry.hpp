@@ -27,8 +27,10 @@ struct OracleColumnMetadata {
 	string oracle_data_type;
 	OracleTypeCategory category;
 	bool needs_server_conversion; // Determined at runtime based on type category
+	idx_t data_length;            // ALL_TAB_COLUMNS.DATA_LENGTH in bytes (0 if unknown)
 
-	OracleColumnMetadata(const string &name, const string &data_type) : column_name(name), oracle_data_type(data_type) {
+	OracleColumnMetadata(const string &name, const string &data_type, idx_t data_length_p = 0)
+	    : column_name(name), oracle_data_type(data_type), data_length(data_length_p) {
 		auto upper = StringUtil::Upper(data_type);
 
 		// Classify Oracle type
@@ -114,11 +116,24 @@ public:
 	                                           const string &table_name, shared_ptr<OracleCatalogState> state,
 	                                           const string &duckdb_entry_name = "");
 
+	const string &OracleSchemaName() const {
+		return schema_name;
+	}
+	const string &OracleTableName() const {
+		return table_name;
+	}
+	//! Whether the catalog version moved (DDL detected, caches cleared) since the columns were loaded.
+	bool IsStale() const {
+		return catalog_version != state->CurrentCatalogVersion();
+	}
+
 private:
 	shared_ptr<OracleCatalogState> state;
 	string schema_name;
 	string table_name;
 	vector<OracleColumnMetadata> column_metadata;
+	//! Catalog version read before the columns were loaded.
+	idx_t catalog_version = 0;
 };
 
 } // namespace duckdb
@@ -6,10 +6,12 @@
 #include <oci.h>
 #include "oracle_settings.hpp"
 #include "oracle_connection_manager.hpp"
+#include <future>
 
 namespace duckdb {
 
 class OracleCatalogState;
+struct OracleTableStatistics;
 
 struct OracleBindData : public FunctionData {
 	string connection_string;
@@ -27,6 +29,16 @@ struct OracleBindData : public FunctionData {
 	std::shared_ptr<OCIStmt> stmt;
 	// Metadata kept in bind data
 	bool finished = false;
+	// Dictionary statistics for catalog table scans (nullptr for ad-hoc queries)
+	shared_ptr<OracleTableStatistics> table_stats;
+	// WHERE clauses moved into the Oracle query by OraclePushdownComplexFilter
+	idx_t pushed_filter_count = 0;
+	// Columns compared with `=` by those clauses
+	vector<string> pushed_equality_columns;
+	// Column sets of the table's unique indexes (primary and unique keys); catalog table scans with oracle_point_lookup
+	vector<vector<string>> unique_keys;
+	// Columns come from catalog metadata (OracleBindDescribed) rather than an OCI describe
+	bool catalog_metadata = false;
 
 	OracleBindData();
 
@@ -43,21 +55,63 @@ struct OracleScanState : public GlobalTableFunctionState {
 	vector<OCIDefine *> defines;
 	vector<vector<sb2>> indicators;
 	vector<vector<ub2>> return_lens;
+	vector<ub4> define_sizes;     // per-row buffer size of each define
+	vector<ub2> define_types;     // SQLT type of each define
 	vector<idx_t> column_mapping; // Map output column index to buffer index
 	bool executed = false;
 	bool defines_bound = false;
 	bool finished = false;
+	//! Key lookup on a catalog table (oracle_point_lookup): the execute also fetches the first batch.
+	bool point_lookup = false;
+	//! Rows per OCIStmtFetch2 call (at most STANDARD_VECTOR_SIZE, the define buffer capacity).
+	ub4 fetch_rows = STANDARD_VECTOR_SIZE;
+
+	// Adaptive prefetch sampling: until tuned, fetched bytes are measured to size later round trips
+	bool tuned = true;
+	double round_trip_seconds = 0;
+	idx_t sampled_fetches = 0;
+	idx_t sampled_rows = 0;
+	idx_t sampled_bytes = 0;
+
+	// Read-ahead (oracle_read_ahead): the next batch is fetched by an I/O thread into these buffers while the current
+	// one is converted; swapped with buffers/indicators/return_lens when it is consumed.
+	vector<vector<char>> ahead_buffers;
+	vector<vector<sb2>> ahead_indicators;
+	vector<vector<ub2>> ahead_return_lens;
+	//! Fetch status and row count of the outstanding read-ahead fetch.
+	std::future<std::pair<sword, ub4>> pending_fetch;
+	//! Execute and first fetch started in OracleInitGlobal (oracle_speculative_execute); consumed by the first call.
+	std::future<std::pair<sword, ub4>> pending_execute;
 
 	explicit OracleScanState(idx_t column_count) {
 		buffers.resize(column_count);
 		defines.assign(column_count, nullptr);
 		indicators.resize(column_count);
 		return_lens.resize(column_count);
+		define_sizes.assign(column_count, 0);
+		define_types.assign(column_count, SQLT_STR);
 	}
 
+	//! The I/O thread writes into this state's buffers through its statement.
+	~OracleScanState() override;
+
+	//! Wait for outstanding I/O-thread calls; a speculative execute that was never consumed is broken first.
+	void WaitForPending();
+
 	idx_t MaxThreads() const override {
 		return 1; // streaming cursor per scan
 	}
+
+	//! Close the cursor and hand the session back to the pool once the scan is exhausted or failed, rather than when
+	//! DuckDB destroys the global state at the end of the query.
+	void Release() {
+		WaitForPending();
+		stmt.reset();
+		defines.assign(defines.size(), nullptr);
+		conn_handle.reset();
+		svc = nullptr;
+		err = nullptr;
+	}
 };
 
 unique_ptr<FunctionData> OracleBindInternal(ClientContext &context, string connection_string, string query,
@@ -65,11 +119,27 @@ unique_ptr<FunctionData> OracleBindInternal(ClientContext &context, string conne
                                             OracleBindData *bind_data_ptr = nullptr,
                                             OracleCatalogState *state = nullptr);
 
+//! Bind a query whose result columns are already known (e.g. from ALL_TAB_COLUMNS), skipping the OCI describe.
+//! types drive the define types in OracleInitGlobal; oci_types/oci_sizes mirror what a describe would report.
+unique_ptr<FunctionData> OracleBindDescribed(ClientContext &context, string connection_string, string query,
+                                             const vector<string> &names, const vector<LogicalType> &types,
+                                             const vector<ub2> &oci_types, const vector<ub4> &oci_sizes,
+                                             OracleBindData *bind_data_ptr = nullptr,
+                                             OracleCatalogState *state = nullptr);
+
+//! Drop the describe results cached by OracleBindInternal (oracle_clear_cache, DDL detected by a catalog).
+void OracleClearDescribeCache();
+
 void OracleQueryFunction(ClientContext &context, TableFunctionInput &data, DataChunk &output);
 
 void OraclePushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
                                  vector<unique_ptr<Expression>> &expressions);
 
+unique_ptr<NodeStatistics> OracleScanCardinality(ClientContext &context, const FunctionData *bind_data_p);
+
+unique_ptr<BaseStatistics> OracleScanStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                column_t column_index);
+
 unique_ptr<GlobalTableFunctionState> OracleInitGlobal(ClientContext &context, TableFunctionInitInput &input);
 
 } // namespace duckdb
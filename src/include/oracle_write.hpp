@@ -2,12 +2,33 @@
 
 #include "duckdb.hpp"
 #include "oracle_connection.hpp"
+#include "oracle_settings.hpp"
 #include "duckdb/function/copy_function.hpp"
 #include "duckdb/common/vector.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace duckdb {
 
+//! How a column is bound for the INSERT: as an OCI native type written straight from the vector data, or as text
+//! (converted server-side, e.g. by TO_DATE, when the target needs it).
+enum class OracleWriteBindKind : uint8_t {
+	TEXT,      // SQLT_CHR / SQLT_LBI / SQLT_LNG
+	INT64,     // SQLT_INT
+	DOUBLE,    // SQLT_BDOUBLE
+	NUMBER,    // SQLT_VNU (DECIMAL up to 18 digits)
+	DATE,      // SQLT_DAT
+	TIMESTAMP, // SQLT_TIMESTAMP descriptors
+	BOOLEAN    // SQLT_INT 0/1
+};
+
+//! Bytes per element of a natively bound column.
+idx_t OracleWriteBindSize(OracleWriteBindKind kind);
+
 struct OracleWriteBindData : public FunctionData {
 	string table_name;
 	string connection_string;
@@ -21,6 +42,26 @@ struct OracleWriteBindData : public FunctionData {
 
 	// Oracle metadata for smart binding
 	vector<string> oracle_types; // e.g., "NUMBER", "BLOB", "SDO_GEOMETRY"
+	// ALL_TAB_COLUMNS.DATA_LENGTH (0 when unknown); sizes the bind arrays of character and RAW columns
+	vector<idx_t> oracle_lengths;
+	vector<OracleWriteBindKind> bind_kinds;
+
+	// METHOD 'direct_path': load through the OCI Direct Path API instead of array INSERT
+	bool direct_path = false;
+	// NOLOGGING: direct-path load without redo generation
+	bool nologging = false;
+	// PARALLEL n: direct-path streams, each on its own session
+	idx_t parallel = 1;
+	// WRITERS n: INSERT sessions fed by the parallel COPY sinks
+	idx_t writers = 1;
+	// STAGING: with several writers, insert into a staging table merged into the target in one transaction
+	bool staging = true;
+	// REJECT_LIMIT n: rows Oracle may reject (OCI_BATCH_ERRORS) before the COPY fails; 0 fails on the first error
+	idx_t reject_limit = 0;
+	// REJECT_TABLE: Oracle table receiving rejected rows with their ORA- code and message (created if missing)
+	string reject_table;
+	// Session settings of the COPY's client (pool limits, session init) for every session it acquires
+	OracleSettings settings;
 
 public:
 	unique_ptr<FunctionData> Copy() const override {
@@ -32,6 +73,16 @@ public:
 		result->column_names = column_names;
 		result->column_types = column_types;
 		result->oracle_types = oracle_types;
+		result->oracle_lengths = oracle_lengths;
+		result->bind_kinds = bind_kinds;
+		result->direct_path = direct_path;
+		result->nologging = nologging;
+		result->parallel = parallel;
+		result->writers = writers;
+		result->staging = staging;
+		result->reject_limit = reject_limit;
+		result->reject_table = reject_table;
+		result->settings = settings;
 		return std::move(result);
 	}
 
@@ -41,43 +92,134 @@ public:
 	}
 };
 
-class OracleWriteGlobalState : public GlobalFunctionData {
+//! One OCI Direct Path Load stream into the target table: rows are converted from DuckDB vectors into a column
+//! array, turned into a stream and loaded without going through the SQL engine. Finish() saves the loaded data;
+//! destroying an unfinished loader aborts the load.
+class OracleDirectPathLoader {
 public:
-	OracleWriteGlobalState(std::shared_ptr<OracleConnectionHandle> conn, const string &query);
-	~OracleWriteGlobalState() override;
+	OracleDirectPathLoader(std::shared_ptr<OracleConnectionHandle> conn, const OracleWriteBindData &data);
+	~OracleDirectPathLoader();
+
+	void Append(DataChunk &chunk);
+	//! Copy the chunk and hand it to the stream's worker thread; waits for (and rethrows from) the previous append
+	//! first.
+	void AppendAsync(DataChunk &chunk);
+	void Wait();
+	void Finish();
+
+private:
+	void LoadRows(DataChunk &chunk, idx_t offset, idx_t count);
+	//! Worker thread of AppendAsync: loads pending_chunk each time it is handed one, until the loader is destroyed.
+	void RunWorker();
 
 	std::shared_ptr<OracleConnectionHandle> connection;
-	OCIStmt *stmthp;
+	//! Per-column conversion chosen for the INSERT path; values are formatted as text the target type accepts
+	vector<OracleWriteBindKind> bind_kinds;
+	OCIDirPathCtx *dpctx = nullptr;
+	OCIDirPathColArray *dpca = nullptr;
+	OCIDirPathStream *dpstr = nullptr;
+	//! Rows the column array holds
+	ub4 max_rows = 0;
+	bool prepared = false;
+	bool finished = false;
+
+	//! Text of values that are not strings in DuckDB (numbers, dates, ...) for the rows in the column array
+	string arena;
+
+	DataChunk pending_chunk;
+	std::thread worker;
+	std::mutex worker_lock;
+	std::condition_variable worker_cv;
+	//! pending_chunk is handed to the worker and not loaded yet
+	bool has_work = false;
+	bool stopping = false;
+	std::exception_ptr worker_error;
 };
 
-class OracleWriteLocalState : public LocalFunctionData {
+//! Rows rejected across all writers of a COPY.
+struct OracleWriteRejects {
+	idx_t limit = 0;
+	//! INSERT into the reject table, empty when rejected rows are only counted
+	string insert_sql;
+	std::atomic<idx_t> count {0};
+};
+
+//! One INSERT writer: a session of its own with its prepared statement and bind arrays. COPY local states are
+//! assigned round-robin to the WRITERS writers and hold the writer's lock for each batch. Uncommitted rows are rolled
+//! back when the writer is destroyed.
+class OracleWriteSession {
 public:
-	OracleWriteLocalState(std::shared_ptr<OracleConnectionHandle> conn, OCIStmt *stmthp);
-	~OracleWriteLocalState() override;
+	OracleWriteSession(std::shared_ptr<OracleConnectionHandle> conn, const string &query, OracleWriteRejects &rejects);
+	~OracleWriteSession();
 
-	void Sink(DataChunk &chunk, const vector<string> &oracle_types);
-	void Flush();
+	void Sink(DataChunk &chunk, const OracleWriteBindData &data);
+	void Commit();
 
-	friend void OracleWriteSink(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
-	                            LocalFunctionData &lstate, DataChunk &input);
+	std::mutex lock;
 
 private:
-	void BindColumn(Vector &col, idx_t col_idx, idx_t count);
-	void ExecuteBatch(idx_t count);
+	void BindColumn(Vector &strings, idx_t col_idx, idx_t count);
+	void BindNativeColumn(Vector &col, idx_t col_idx, idx_t count, OracleWriteBindKind kind);
+	void ExecuteBatch(DataChunk &chunk, const OracleWriteBindData &data);
+	//! Count the rows OCI_BATCH_ERRORS reported for the last batch and record them in the reject table.
+	void HandleRejects(DataChunk &chunk, const OracleWriteBindData &data);
 
 	std::shared_ptr<OracleConnectionHandle> connection;
-	OCIStmt *stmthp;
-
-	// Buffers for binding
-	std::vector<std::vector<char>> bind_buffers;
+	OCIStmt *stmthp = nullptr;
+	OracleWriteRejects &rejects;
+	OCIStmt *reject_stmthp = nullptr;
+	OCIError *row_errhp = nullptr;
+	bool pending_rows = false;
+
+	// Bind arrays of all columns, laid out back to back in one arena that only grows; column col_idx starts at
+	// bind_offsets[col_idx] and holds MAX_BATCH_SIZE elements of current_buffer_sizes[col_idx] bytes
+	std::vector<char> bind_arena;
+	std::vector<size_t> bind_offsets;
 	std::vector<std::vector<sb2>> indicator_buffers;
 	std::vector<std::vector<ub2>> length_buffers;
 	std::vector<OCIBind *> binds;
 	std::vector<size_t> current_buffer_sizes;
+	// OCIDateTime descriptors of TIMESTAMP columns (one per batch row)
+	std::vector<std::vector<OCIDateTime *>> timestamps;
 
 	static constexpr idx_t MAX_BATCH_SIZE = STANDARD_VECTOR_SIZE;
 };
 
+class OracleWriteGlobalState : public GlobalFunctionData {
+public:
+	//! insert_sql is empty for direct-path loads, whose loaders are created on the first sink.
+	OracleWriteGlobalState(std::shared_ptr<OracleConnectionHandle> conn, string insert_sql);
+	~OracleWriteGlobalState() override;
+
+	//! Writer for a local state's first sink; the first writer uses the COPY session, further ones their own.
+	OracleWriteSession &AssignWriter(const OracleWriteBindData &data);
+
+	std::shared_ptr<OracleConnectionHandle> connection;
+	string insert_sql;
+	//! Quoted name of the staging table the writers insert into (WRITERS > 1 with STAGING); merged into the target
+	//! in one transaction by OracleWriteFinalize and dropped afterwards.
+	string staging_table;
+	OracleWriteRejects rejects;
+
+	std::mutex writer_lock;
+	//! One slot per writer, sized by OracleWriteInitGlobal and filled when a local state first uses it
+	vector<unique_ptr<OracleWriteSession>> writers;
+	idx_t next_writer = 0;
+	//! Signalled when a writer slot is filled, or when opening a writer's session failed
+	std::condition_variable writer_ready;
+	bool writer_failed = false;
+
+	// Direct-path streams; chunks are dealt round-robin when PARALLEL > 1
+	std::mutex load_lock;
+	vector<unique_ptr<OracleDirectPathLoader>> loaders;
+	idx_t next_loader = 0;
+};
+
+class OracleWriteLocalState : public LocalFunctionData {
+public:
+	OracleWriteSession *writer = nullptr;
+};
+
 // CopyFunction implementations
 unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBindInput &input,
                                          const vector<string> &names, const vector<LogicalType> &sql_types);
@@ -87,6 +229,9 @@ unique_ptr<GlobalFunctionData> OracleWriteInitGlobal(ClientContext &context, Fun
 
 unique_ptr<LocalFunctionData> OracleWriteInitLocal(ExecutionContext &context, FunctionData &bind_data);
 
+//! Sinks run in parallel; a heap table has no row order to preserve.
+CopyFunctionExecutionMode OracleWriteExecutionMode(bool preserve_insertion_order, bool supports_batch_index);
+
 void OracleWriteSink(ExecutionContext &context, FunctionData &bind_data, GlobalFunctionData &gstate,
                      LocalFunctionData &lstate, DataChunk &input);
 
@@ -1,8 +1,10 @@
 #include "oracle_connection.hpp"
+#include "duckdb/common/helper.hpp"
 #include "duckdb/common/string_util.hpp"
 #include <cstring>
 #include <functional>
 #include <cstdio>
+#include <cstdlib>
 
 namespace duckdb {
 
@@ -28,11 +30,14 @@ OracleConnection::~OracleConnection() {
 }
 
 void OracleConnection::Connect(const std::string &connection_string) {
+	// Use default settings for catalog connections
+	Connect(connection_string, OracleSettings());
+}
+
+void OracleConnection::Connect(const std::string &connection_string, const OracleSettings &settings) {
 	if (conn_handle) {
 		return;
 	}
-	// Use default settings for catalog connections
-	OracleSettings settings;
 	conn_handle = OracleConnectionManager::Instance().Acquire(connection_string, settings);
 }
 
@@ -40,6 +45,39 @@ bool OracleConnection::IsConnected() const {
 	return conn_handle != nullptr;
 }
 
+//! Upper bound on rows per OCIStmtFetch2 call for metadata queries.
+static constexpr ub4 QUERY_FETCH_ARRAY_SIZE = 256;
+//! Define buffers for one fetch are kept under this many bytes; wide columns fetch fewer rows per call.
+static constexpr idx_t QUERY_FETCH_BUFFER_BYTES = 4 * 1024 * 1024;
+//! Initial width for columns without a meaningful describe size (LOBs, LONG, computed expressions).
+static constexpr ub4 QUERY_DEFAULT_WIDTH = 4096;
+//! A single metadata value larger than this is reported as an error instead of growing the buffers further.
+static constexpr ub4 QUERY_MAX_WIDTH = 64 * 1024 * 1024;
+
+static ub4 InitialDefineWidth(ub2 data_type, ub2 data_size) {
+	switch (data_type) {
+	case SQLT_CHR:
+	case SQLT_AFC:
+	case SQLT_VCS:
+	case SQLT_AVC:
+		// DATA_SIZE is in database character set bytes; leave room for expansion to the client character set.
+		return MaxValue<ub4>(static_cast<ub4>(data_size) * 4, 64);
+	case SQLT_BIN:
+		// RAW is converted to hex text.
+		return MaxValue<ub4>(static_cast<ub4>(data_size) * 2, 64);
+	case SQLT_NUM:
+	case SQLT_VNU:
+		return 64;
+	case SQLT_DAT:
+	case SQLT_TIMESTAMP:
+	case SQLT_TIMESTAMP_TZ:
+	case SQLT_TIMESTAMP_LTZ:
+		return 128;
+	default:
+		return QUERY_DEFAULT_WIDTH;
+	}
+}
+
 OracleResult OracleConnection::Query(const std::string &query) {
 	if (!conn_handle) {
 		throw IOException("OracleConnection::Query called before Connect");
@@ -58,6 +96,11 @@ OracleResult OracleConnection::Query(const std::string &query) {
 	    OCIStmtPrepare(stmthp, ctx->errhp, (OraText *)query.c_str(), query.size(), OCI_NTV_SYNTAX, OCI_DEFAULT),
 	    ctx->errhp, "OCIStmtPrepare");
 
+	// Metadata queries can return many thousands of rows; let OCI transfer them in batches.
+	ub4 prefetch_rows = 1024;
+	CheckOCIError(OCIAttrSet(stmthp, OCI_HTYPE_STMT, &prefetch_rows, 0, OCI_ATTR_PREFETCH_ROWS, ctx->errhp),
+	              ctx->errhp, "OCI_ATTR_PREFETCH_ROWS");
+
 	CheckOCIError(OCIStmtExecute(ctx->svchp, stmthp, ctx->errhp, 0, 0, nullptr, nullptr, OCI_DESCRIBE_ONLY), ctx->errhp,
 	              "OCIStmtExecute describe");
 
@@ -66,6 +109,7 @@ OracleResult OracleConnection::Query(const std::string &query) {
 	              "OCI_ATTR_PARAM_COUNT");
 
 	OracleResult result;
+	std::vector<ub4> widths(param_count);
 	for (ub4 i = 1; i <= param_count; i++) {
 		OCIParam *param = nullptr;
 		CheckOCIError(OCIParamGet(stmthp, OCI_HTYPE_STMT, ctx->errhp, (dvoid **)&param, i), ctx->errhp, "OCIParamGet");
@@ -74,51 +118,150 @@ OracleResult OracleConnection::Query(const std::string &query) {
 		ub4 col_name_len = 0;
 		CheckOCIError(OCIAttrGet(param, OCI_DTYPE_PARAM, &col_name, &col_name_len, OCI_ATTR_NAME, ctx->errhp),
 		              ctx->errhp, "OCI_ATTR_NAME");
-		result.columns.emplace_back((char *)col_name, col_name_len);
-	}
+		result.AddColumn(std::string((char *)col_name, col_name_len));
 
-	// Re-execute to fetch rows
-	CheckOCIError(OCIStmtExecute(ctx->svchp, stmthp, ctx->errhp, 0, 0, nullptr, nullptr, OCI_DEFAULT), ctx->errhp,
-	              "OCIStmtExecute fetch");
+		ub2 data_type = 0;
+		ub2 data_size = 0;
+		CheckOCIError(OCIAttrGet(param, OCI_DTYPE_PARAM, &data_type, 0, OCI_ATTR_DATA_TYPE, ctx->errhp), ctx->errhp,
+		              "OCI_ATTR_DATA_TYPE");
+		CheckOCIError(OCIAttrGet(param, OCI_DTYPE_PARAM, &data_size, 0, OCI_ATTR_DATA_SIZE, ctx->errhp), ctx->errhp,
+		              "OCI_ATTR_DATA_SIZE");
+		widths[i - 1] = InitialDefineWidth(data_type, data_size);
+	}
 
-	// Bind all columns as strings
 	std::vector<std::vector<char>> buffers(param_count);
-	std::vector<ub2> lengths(param_count);
-	std::vector<sb2> indicators(param_count);
+	std::vector<std::vector<sb2>> indicators(param_count);
+	std::vector<std::vector<ub4>> lengths(param_count);
+	std::vector<std::vector<ub2>> rcodes(param_count);
 	std::vector<OCIDefine *> defines(param_count, nullptr);
 
-	const ub4 buffer_size = 4096;
-	for (ub4 i = 0; i < param_count; i++) {
-		buffers[i].resize(buffer_size);
-		CheckOCIError(OCIDefineByPos(stmthp, &defines[i], ctx->errhp, i + 1, buffers[i].data(), buffer_size, SQLT_STR,
-		                             &indicators[i], &lengths[i], nullptr, OCI_DEFAULT),
-		              ctx->errhp, "OCIDefineByPos");
-	}
-
-	idx_t rows = 0;
+	// A value wider than its define buffer is fetched again with wider buffers rather than truncated. Metadata
+	// values of that size (view text, long comments) are rare, so restarting the statement is cheaper than
+	// piecewise fetching every column.
 	while (true) {
-		auto status = OCIStmtFetch2(stmthp, ctx->errhp, 1, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
-		if (status == OCI_NO_DATA) {
-			break;
+		idx_t row_width = 0;
+		for (auto width : widths) {
+			row_width += width;
+		}
+		ub4 array_size = QUERY_FETCH_ARRAY_SIZE;
+		if (row_width > 0) {
+			array_size = static_cast<ub4>(
+			    MinValue<idx_t>(MaxValue<idx_t>(QUERY_FETCH_BUFFER_BYTES / row_width, 1), QUERY_FETCH_ARRAY_SIZE));
 		}
-		CheckOCIError(status, ctx->errhp, "OCIStmtFetch2");
-		rows++;
 
-		std::vector<std::string> row;
-		row.reserve(param_count);
+		CheckOCIError(OCIStmtExecute(ctx->svchp, stmthp, ctx->errhp, 0, 0, nullptr, nullptr, OCI_DEFAULT),
+		              ctx->errhp, "OCIStmtExecute fetch");
+
 		for (ub4 i = 0; i < param_count; i++) {
-			if (indicators[i] == -1) {
-				row.emplace_back();
-			} else {
-				row.emplace_back(buffers[i].data(), lengths[i]);
+			buffers[i].resize(static_cast<idx_t>(widths[i]) * array_size);
+			indicators[i].resize(array_size);
+			lengths[i].resize(array_size);
+			rcodes[i].resize(array_size);
+			CheckOCIError(OCIDefineByPos2(stmthp, &defines[i], ctx->errhp, i + 1, buffers[i].data(),
+			                              static_cast<sb8>(widths[i]), SQLT_CHR, indicators[i].data(),
+			                              lengths[i].data(), rcodes[i].data(), OCI_DEFAULT),
+			              ctx->errhp, "OCIDefineByPos2");
+		}
+
+		bool truncated = false;
+		while (!truncated) {
+			auto status = OCIStmtFetch2(stmthp, ctx->errhp, array_size, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
+			if (status != OCI_NO_DATA) {
+				CheckOCIError(status, ctx->errhp, "OCIStmtFetch2");
+			}
+			// The last batch comes back together with OCI_NO_DATA, so always read the fetched row count.
+			ub4 fetched = 0;
+			CheckOCIError(OCIAttrGet(stmthp, OCI_HTYPE_STMT, &fetched, 0, OCI_ATTR_ROWS_FETCHED, ctx->errhp),
+			              ctx->errhp, "OCI_ATTR_ROWS_FETCHED");
+
+			for (ub4 i = 0; i < param_count; i++) {
+				for (ub4 r = 0; r < fetched; r++) {
+					if (rcodes[i][r] != 1406 && indicators[i][r] <= 0) {
+						continue;
+					}
+					// ORA-01406: the indicator holds the full length when it fits in sb2, otherwise -2.
+					ub4 needed = indicators[i][r] > 0 ? static_cast<ub4>(indicators[i][r]) + 1 : widths[i] * 4;
+					widths[i] = MaxValue<ub4>(needed, widths[i] * 2);
+					truncated = true;
+				}
+				if (widths[i] > QUERY_MAX_WIDTH) {
+					throw IOException("Oracle metadata value in column %s exceeds %d bytes", result.ColumnName(i),
+					                  static_cast<int>(QUERY_MAX_WIDTH));
+				}
 			}
+			if (truncated) {
+				break;
+			}
+
+			for (ub4 i = 0; i < param_count; i++) {
+				auto base = buffers[i].data();
+				for (ub4 r = 0; r < fetched; r++) {
+					if (indicators[i][r] == -1) {
+						result.AppendNull(i);
+					} else {
+						result.Append(i, base + static_cast<idx_t>(r) * widths[i], lengths[i][r]);
+					}
+				}
+			}
+			if (status == OCI_NO_DATA) {
+				break;
+			}
+		}
+		if (!truncated) {
+			break;
 		}
-		result.rows.push_back(std::move(row));
+		if (getenv("ORACLE_DEBUG")) {
+			fprintf(stderr, "[oracle] metadata query value truncated; re-fetching with wider buffers\n");
+		}
+		result.ClearRows();
 	}
 
 	return result;
 }
 
+void OracleConnection::Execute(const std::string &statement) {
+	if (!conn_handle) {
+		throw IOException("OracleConnection::Execute called before Connect");
+	}
+
+	auto ctx = conn_handle->Get();
+
+	OCIStmt *stmthp = nullptr;
+	CheckOCIError(OCIHandleAlloc(ctx->envhp, (dvoid **)&stmthp, OCI_HTYPE_STMT, 0, nullptr), ctx->errhp,
+	              "OCIHandleAlloc stmthp");
+
+	auto cleanup_stmt = std::unique_ptr<OCIStmt, std::function<void(OCIStmt *)>>(
+	    stmthp, [&](OCIStmt *stmt) { OCIHandleFree(stmt, OCI_HTYPE_STMT); });
+
+	CheckOCIError(OCIStmtPrepare(stmthp, ctx->errhp, (OraText *)statement.c_str(), statement.size(), OCI_NTV_SYNTAX,
+	                             OCI_DEFAULT),
+	              ctx->errhp, "OCIStmtPrepare");
+	CheckOCIError(OCIStmtExecute(ctx->svchp, stmthp, ctx->errhp, 1, 0, nullptr, nullptr, OCI_DEFAULT), ctx->errhp,
+	              "OCIStmtExecute");
+}
+
+int64_t OracleConnection::GetCurrentScn() {
+	// DBMS_FLASHBACK requires an EXECUTE grant, so fall back to TIMESTAMP_TO_SCN which every user may call.
+	std::string scn;
+	try {
+		auto result = Query("SELECT TO_CHAR(DBMS_FLASHBACK.GET_SYSTEM_CHANGE_NUMBER) FROM DUAL");
+		if (result.RowCount() > 0) {
+			scn = result.GetString(0, 0);
+		}
+	} catch (std::exception &) {
+	}
+	if (scn.empty()) {
+		auto result = Query("SELECT TO_CHAR(TIMESTAMP_TO_SCN(SYSTIMESTAMP)) FROM DUAL");
+		if (result.RowCount() > 0) {
+			scn = result.GetString(0, 0);
+		}
+	}
+	if (scn.empty()) {
+		throw IOException("Failed to read the current Oracle SCN");
+	}
+	return std::stoll(scn);
+}
+
 void OracleConnection::Commit() {
 	if (!conn_handle) {
 		throw IOException("OracleConnection::Commit called before Connect");
@@ -139,11 +282,33 @@ std::shared_ptr<OracleConnectionHandle> OracleConnection::GetHandle() const {
 	return conn_handle;
 }
 
-std::string OracleResult::GetString(idx_t row, idx_t col) const {
-	if (row >= rows.size() || col >= rows[row].size()) {
+idx_t OracleResult::RowCount() const {
+	return data.empty() ? 0 : data[0].nulls.size();
+}
+
+const std::string &OracleResult::ColumnName(idx_t col) const {
+	if (col >= columns.size()) {
+		throw InternalException("OracleResult column index out of range");
+	}
+	return columns[col];
+}
+
+void OracleResult::CheckIndex(idx_t row, idx_t col) const {
+	if (col >= data.size() || row >= data[col].nulls.size()) {
 		throw InternalException("OracleResult index out of range");
 	}
-	return rows[row][col];
+}
+
+bool OracleResult::IsNull(idx_t row, idx_t col) const {
+	CheckIndex(row, col);
+	return data[col].nulls[row];
+}
+
+std::string OracleResult::GetString(idx_t row, idx_t col) const {
+	CheckIndex(row, col);
+	auto &column = data[col];
+	auto begin = column.offsets[row];
+	return column.values.substr(begin, column.offsets[row + 1] - begin);
 }
 
 int64_t OracleResult::GetInt64(idx_t row, idx_t col) const {
@@ -154,4 +319,30 @@ double OracleResult::GetDouble(idx_t row, idx_t col) const {
 	return std::stod(GetString(row, col));
 }
 
+void OracleResult::AddColumn(std::string name) {
+	columns.push_back(std::move(name));
+	data.emplace_back();
+}
+
+void OracleResult::Append(idx_t col, const char *value, idx_t length) {
+	auto &column = data[col];
+	column.values.append(value, length);
+	column.offsets.push_back(column.values.size());
+	column.nulls.push_back(false);
+}
+
+void OracleResult::AppendNull(idx_t col) {
+	auto &column = data[col];
+	column.offsets.push_back(column.values.size());
+	column.nulls.push_back(true);
+}
+
+void OracleResult::ClearRows() {
+	for (auto &column : data) {
+		column.values.clear();
+		column.offsets.assign(1, 0);
+		column.nulls.clear();
+	}
+}
+
 } // namespace duckdb
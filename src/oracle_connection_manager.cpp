@@ -1,6 +1,11 @@
 #include "oracle_connection_manager.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_context.hpp"
+#include <atomic>
 #include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <unordered_set>
 
 namespace duckdb {
 
@@ -30,11 +35,91 @@ static void ParseOracleConnectionString(const std::string &connection_string, st
 	db = connection_string.substr(at_pos + 1);
 }
 
+//! Local check (no round trip): OCI marks the server handle once it has seen the connection drop.
+static bool ServerConnected(OracleContext &ctx) {
+	if (!ctx.srvhp) {
+		return false;
+	}
+	ub4 status = OCI_SERVER_NOT_CONNECTED;
+	auto rc = OCIAttrGet(ctx.srvhp, OCI_HTYPE_SERVER, &status, nullptr, OCI_ATTR_SERVER_STATUS, ctx.errhp);
+	return rc == OCI_SUCCESS && status == OCI_SERVER_NORMAL;
+}
+
+//! DRCP needs a pooled-server connect identifier. EZConnect strings get ":POOLED" appended; TNS aliases and
+//! descriptors must specify (SERVER=POOLED) themselves.
+static std::string DrcpConnectIdentifier(const std::string &db) {
+	if (db.find('(') != std::string::npos || db.find('/') == std::string::npos ||
+	    StringUtil::Contains(StringUtil::Upper(db), ":POOLED")) {
+		return db;
+	}
+	return db + ":POOLED";
+}
+
+//! NLS setup and the session_init profile as one anonymous block, so logon pays a single round trip. ALTER/SET
+//! statements run through EXECUTE IMMEDIATE; anything else is taken as a PL/SQL call.
+static std::string SessionInitBlock(const OracleSettings &settings) {
+	std::string block = "BEGIN EXECUTE IMMEDIATE 'ALTER SESSION SET NLS_DATE_FORMAT = ''YYYY-MM-DD HH24:MI:SS'' "
+	                    "NLS_TIMESTAMP_FORMAT = ''YYYY-MM-DD HH24:MI:SS.FF''';";
+	auto add_statement = [&](const std::string &raw) {
+		auto statement = raw;
+		StringUtil::Trim(statement);
+		if (statement.empty()) {
+			return;
+		}
+		auto upper = StringUtil::Upper(statement);
+		if (StringUtil::StartsWith(upper, "ALTER ") || StringUtil::StartsWith(upper, "SET ")) {
+			block += " EXECUTE IMMEDIATE '" + StringUtil::Replace(statement, "'", "''") + "';";
+		} else {
+			block += " " + statement + ";";
+		}
+	};
+	// Split on ';' outside string literals
+	std::string current;
+	bool in_quote = false;
+	for (auto c : settings.session_init) {
+		if (c == '\'') {
+			in_quote = !in_quote;
+		}
+		if (c == ';' && !in_quote) {
+			add_statement(current);
+			current.clear();
+		} else {
+			current += c;
+		}
+	}
+	add_statement(current);
+	return block + " END;";
+}
+
+//! Session tag identifying the init profile; pooled sessions carrying it skip SessionInitBlock.
+static std::string SessionTag(const OracleSettings &settings) {
+	char hex[32];
+	snprintf(hex, sizeof(hex), "%016llx",
+	         static_cast<unsigned long long>(std::hash<std::string>()(SessionInitBlock(settings))));
+	return std::string("DUCKDB_INIT=") + hex;
+}
+
 OracleContext::~OracleContext() {
 	if (stmthp) {
 		OCIHandleFree(stmthp, OCI_HTYPE_STMT);
 		stmthp = nullptr;
 	}
+	if (session_pooled) {
+		// Service context, server and session belong to the OCI session pool; drop the session if it is dead.
+		if (svchp && errhp) {
+			if (!ServerConnected(*this)) {
+				OCISessionRelease(svchp, errhp, nullptr, 0, OCI_SESSRLS_DROPSESS);
+			} else if (!session_tag.empty()) {
+				OCISessionRelease(svchp, errhp, (OraText *)session_tag.c_str(), (ub4)session_tag.size(),
+				                  OCI_SESSRLS_RETAG);
+			} else {
+				OCISessionRelease(svchp, errhp, nullptr, 0, OCI_DEFAULT);
+			}
+		}
+		svchp = nullptr;
+		srvhp = nullptr;
+		authp = nullptr;
+	}
 	if (svchp && authp && errhp) {
 		OCISessionEnd(svchp, errhp, authp, OCI_DEFAULT);
 	}
@@ -63,19 +148,179 @@ OracleContext::~OracleContext() {
 	}
 }
 
+static bool DebugPool(const OracleSettings &settings) {
+	return settings.debug_show_queries || getenv("ORACLE_DEBUG");
+}
+
+//! Remove idle sessions that outlived connection_max_lifetime, sat idle past connection_max_idle_time (down to
+//! min_connections) or lost their server. Removed sessions are closed by the caller after releasing the pool lock.
+static void EvictIdle(OracleConnectionPool &pool, const OracleSettings &settings,
+                      std::chrono::steady_clock::time_point now,
+                      std::vector<std::shared_ptr<OracleContext>> &retired) {
+	auto max_lifetime = std::chrono::seconds(static_cast<int64_t>(settings.connection_max_lifetime));
+	auto max_idle = std::chrono::seconds(static_cast<int64_t>(settings.connection_max_idle_time));
+	for (auto it = pool.idle.begin(); it != pool.idle.end();) {
+		auto &ctx = **it;
+		bool expired = settings.connection_max_lifetime > 0 && now - ctx.created_at >= max_lifetime;
+		bool idle_too_long = settings.connection_max_idle_time > 0 && now - ctx.last_used >= max_idle &&
+		                     pool.total > settings.min_connections;
+		if (expired || idle_too_long || !ServerConnected(ctx)) {
+			retired.push_back(std::move(*it));
+			it = pool.idle.erase(it);
+			pool.total--;
+			pool.evictions++;
+		} else {
+			++it;
+		}
+	}
+}
+
+//! Count one acquisition and its queueing time (logon time excluded). Caller holds pool.lock.
+static void RecordAcquire(OracleConnectionPool &pool, std::chrono::steady_clock::time_point start, bool waited) {
+	auto wait_us = static_cast<idx_t>(
+	    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+	static constexpr idx_t BUCKET_BOUNDS_US[] = {1000, 10000, 100000, 1000000};
+	idx_t bucket = 0;
+	while (bucket < OracleConnectionPool::WAIT_BUCKETS - 1 && wait_us >= BUCKET_BOUNDS_US[bucket]) {
+		bucket++;
+	}
+	pool.acquires++;
+	pool.waits += waited ? 1 : 0;
+	pool.wait_histogram[bucket]++;
+	pool.total_wait_us += wait_us;
+}
+
+//! Pool key as shown by oracle_pool_stats(): user/***@connect_identifier[#backend].
+static std::string RedactPoolKey(const std::string &key) {
+	auto slash_pos = key.find('/');
+	auto at_pos = key.find('@', slash_pos == std::string::npos ? 0 : slash_pos);
+	if (slash_pos == std::string::npos || at_pos == std::string::npos) {
+		return key;
+	}
+	return key.substr(0, slash_pos + 1) + "***" + key.substr(at_pos);
+}
+
+//! Sessions bulk acquisitions may hold at once: bulk_connection_limit (0 = pool limit), minus the
+//! reserved_connections kept for interactive work, and at least one.
+static idx_t BulkSessionCap(idx_t limit, const OracleSettings &settings) {
+	auto cap = settings.bulk_connection_limit > 0 ? MinValue(settings.bulk_connection_limit, limit) : limit;
+	auto reserved = MinValue(settings.reserved_connections, limit);
+	return MaxValue<idx_t>(MinValue(cap, limit - reserved), 1);
+}
+
+idx_t OracleConnectionManager::BulkSessionLimit(const OracleSettings &settings) {
+	return BulkSessionCap(settings.connection_limit, settings);
+}
+
+OracleConnectionPool::~OracleConnectionPool() {
+	// Idle sessions first: session-pooled ones must be released before their OCI pool is destroyed.
+	idle.clear();
+	if (spoolhp) {
+		OCISessionPoolDestroy(spoolhp, spool_errhp, OCI_SPD_FORCE);
+		OCIHandleFree(spoolhp, OCI_HTYPE_SPOOL);
+		spoolhp = nullptr;
+	}
+	if (spool_errhp) {
+		OCIHandleFree(spool_errhp, OCI_HTYPE_ERROR);
+		spool_errhp = nullptr;
+	}
+}
+
 OracleConnectionHandle::OracleConnectionHandle(std::shared_ptr<OracleConnectionPool> pool_p,
-                                               std::shared_ptr<OracleContext> ctx_p)
-    : pool(std::move(pool_p)), ctx(std::move(ctx_p)) {
+                                               std::shared_ptr<OracleContext> ctx_p, bool bulk_p)
+    : pool(std::move(pool_p)), ctx(std::move(ctx_p)), bulk(bulk_p) {
 }
 
 OracleConnectionHandle::~OracleConnectionHandle() {
 	if (pool && ctx) {
-		std::lock_guard<std::mutex> lock(pool->lock);
-		pool->idle.push_back(std::move(ctx));
-		pool->cv.notify_one();
+		// A session whose server went away must not be handed out again.
+		bool alive = ServerConnected(*ctx);
+		ctx->last_used = std::chrono::steady_clock::now();
+		{
+			std::lock_guard<std::mutex> lock(pool->lock);
+			if (alive && !ctx->session_pooled) {
+				pool->idle.push_back(ctx);
+			} else {
+				pool->total--;
+				pool->evictions += alive ? 0 : 1;
+			}
+			pool->bulk_in_use -= bulk ? 1 : 0;
+			// Waiters differ by priority, so the one woken by notify_one might not be allowed to proceed.
+			pool->cv.notify_all();
+		}
+		// Dropped outside the pool lock: ending a session is a round trip.
+		ctx.reset();
 	}
 }
 
+//! Polls the client contexts of guarded OCI calls and breaks the calls of interrupted queries. One thread for the
+//! process, started on first use and never joined (it only sleeps while no call is guarded).
+class OracleInterruptWatcher {
+public:
+	static OracleInterruptWatcher &Instance() {
+		static auto *instance = new OracleInterruptWatcher();
+		return *instance;
+	}
+
+	void Add(OracleInterruptGuard &guard) {
+		std::lock_guard<std::mutex> lock(mutex);
+		guards.insert(&guard);
+		cv.notify_one();
+	}
+
+	void Remove(OracleInterruptGuard &guard) {
+		// Taking the lock also waits for an OCIBreak on this session to finish.
+		std::lock_guard<std::mutex> lock(mutex);
+		guards.erase(&guard);
+	}
+
+private:
+	OracleInterruptWatcher() {
+		// The break is issued while the session's own error handle is in use by the blocked call.
+		OCIHandleAlloc(OracleConnectionManager::Instance().Env(), (dvoid **)&errhp, OCI_HTYPE_ERROR, 0, nullptr);
+		std::thread([this]() { Run(); }).detach();
+	}
+
+	void Run() {
+		std::unique_lock<std::mutex> lock(mutex);
+		while (true) {
+			if (guards.empty()) {
+				cv.wait(lock);
+			} else {
+				cv.wait_for(lock, std::chrono::milliseconds(50));
+			}
+			for (auto guard : guards) {
+				if (!guard->broken && guard->context.interrupted) {
+					guard->broken = true;
+					OCIBreak(guard->ctx.svchp, errhp);
+				}
+			}
+		}
+	}
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::unordered_set<OracleInterruptGuard *> guards;
+	OCIError *errhp = nullptr;
+};
+
+OracleInterruptGuard::OracleInterruptGuard(ClientContext &context_p, OracleContext &ctx_p)
+    : context(context_p), ctx(ctx_p) {
+	OracleInterruptWatcher::Instance().Add(*this);
+}
+
+OracleInterruptGuard::~OracleInterruptGuard() {
+	OracleInterruptWatcher::Instance().Remove(*this);
+	if (broken) {
+		// Resynchronise the connection after the break so the session can go back to the pool.
+		OCIReset(ctx.svchp, ctx.errhp);
+	}
+}
+
+bool OracleInterruptGuard::Broken() const {
+	return broken;
+}
+
 OracleConnectionManager &OracleConnectionManager::Instance() {
 	static OracleConnectionManager instance;
 	return instance;
@@ -100,27 +345,60 @@ void OracleConnectionManager::Clear() {
 	pools.clear();
 }
 
+std::vector<OracleConnectionPoolStats> OracleConnectionManager::Stats() {
+	std::vector<std::shared_ptr<OracleConnectionPool>> snapshot;
+	{
+		std::lock_guard<std::mutex> lock(manager_mutex);
+		for (auto &entry : pools) {
+			snapshot.push_back(entry.second);
+		}
+	}
+	std::vector<OracleConnectionPoolStats> result;
+	for (auto &pool : snapshot) {
+		std::lock_guard<std::mutex> lock(pool->lock);
+		OracleConnectionPoolStats stats;
+		stats.pool = pool->label;
+		stats.pool_mode = pool->pool_mode;
+		stats.total = pool->total;
+		stats.idle = pool->idle.size();
+		stats.in_use = pool->total - MinValue<idx_t>(pool->total, pool->idle.size());
+		stats.bulk_in_use = pool->bulk_in_use;
+		stats.limit = pool->limit;
+		stats.acquires = pool->acquires;
+		stats.waits = pool->waits;
+		for (idx_t i = 0; i < OracleConnectionPool::WAIT_BUCKETS; i++) {
+			stats.wait_histogram[i] = pool->wait_histogram[i];
+		}
+		stats.total_wait_us = pool->total_wait_us;
+		stats.timeouts = pool->timeouts;
+		stats.creations = pool->creations;
+		stats.evictions = pool->evictions;
+		stats.failed_logons = pool->failed_logons;
+		result.push_back(std::move(stats));
+	}
+	return result;
+}
+
 std::shared_ptr<OracleConnectionHandle> OracleConnectionManager::Acquire(const std::string &connection_string,
                                                                          const OracleSettings &settings,
+                                                                         OracleAcquirePriority priority,
                                                                          idx_t wait_timeout_ms) {
 	// If caching disabled, create a standalone connection
 	if (!settings.connection_cache) {
-		auto ctx = CreateConnection(connection_string, settings);
+		// Session-pooled backends still need the shared OCI session pool.
+		auto pool = settings.pool_mode == "dedicated" ? nullptr : GetPool(connection_string, settings);
+		auto ctx = CreateConnection(connection_string, settings, pool);
 		return std::make_shared<OracleConnectionHandle>(nullptr, std::move(ctx));
 	}
 
-	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_timeout_ms);
-	std::shared_ptr<OracleConnectionPool> pool;
-
-	{
-		std::unique_lock<std::mutex> lock(manager_mutex);
-		auto &p = pools[connection_string];
-		if (!p) {
-			p = std::make_shared<OracleConnectionPool>();
-		}
-		pool = p;
-	}
+	auto start = std::chrono::steady_clock::now();
+	auto deadline = start + std::chrono::milliseconds(wait_timeout_ms);
+	auto pool = GetPool(connection_string, settings);
+	bool waited = false;
+	bool bulk = priority == OracleAcquirePriority::BULK;
 
+	// Declared before the lock so evicted sessions are closed after it is released.
+	std::vector<std::shared_ptr<OracleContext>> retired;
 	// Lock the specific pool
 	std::unique_lock<std::mutex> lock(pool->lock);
 
@@ -130,36 +408,167 @@ std::shared_ptr<OracleConnectionHandle> OracleConnectionManager::Acquire(const s
 	}
 
 	while (true) {
-		if (!pool->idle.empty()) {
+		auto now = std::chrono::steady_clock::now();
+		EvictIdle(*pool, settings, now, retired);
+		// Bulk scans stay out of the reserved slots and below bulk_connection_limit, and let queued interactive
+		// acquisitions go first.
+		bool admitted =
+		    !bulk || (pool->bulk_in_use < BulkSessionCap(pool->limit, settings) && pool->interactive_waiting == 0);
+		if (admitted && !pool->idle.empty()) {
 			auto ctx = pool->idle.back();
 			pool->idle.pop_back();
-			return std::make_shared<OracleConnectionHandle>(pool, std::move(ctx));
+			pool->bulk_in_use += bulk ? 1 : 0;
+			auto validation_interval =
+			    std::chrono::seconds(static_cast<int64_t>(settings.connection_validation_interval));
+			if (now - ctx->last_used < validation_interval) {
+				RecordAcquire(*pool, start, waited);
+				return std::make_shared<OracleConnectionHandle>(pool, std::move(ctx), bulk);
+			}
+			// Idle long enough for a firewall or the server to have dropped it: ping before handing it out.
+			lock.unlock();
+			if (OCIPing(ctx->svchp, ctx->errhp, OCI_DEFAULT) == OCI_SUCCESS) {
+				lock.lock();
+				RecordAcquire(*pool, start, waited);
+				return std::make_shared<OracleConnectionHandle>(pool, std::move(ctx), bulk);
+			}
+			if (DebugPool(settings)) {
+				fprintf(stderr, "[oracle] discarding pooled session that failed validation\n");
+			}
+			ctx.reset();
+			lock.lock();
+			pool->total--;
+			pool->bulk_in_use -= bulk ? 1 : 0;
+			pool->evictions++;
+			continue;
 		}
 
-		if (pool->total < pool->limit) {
+		if (admitted && pool->total < pool->limit) {
 			// Reserve a slot
 			pool->total++;
+			pool->bulk_in_use += bulk ? 1 : 0;
+			RecordAcquire(*pool, start, waited);
 			lock.unlock(); // Unlock pool to create connection
 			try {
-				auto ctx = CreateConnection(connection_string, settings);
-				return std::make_shared<OracleConnectionHandle>(pool, std::move(ctx));
+				auto ctx = CreateConnection(connection_string, settings, pool);
+				lock.lock();
+				pool->creations++;
+				return std::make_shared<OracleConnectionHandle>(pool, std::move(ctx), bulk);
 			} catch (...) {
 				// Rollback reservation
 				lock.lock();
 				pool->total--;
-				pool->cv.notify_one();
+				pool->bulk_in_use -= bulk ? 1 : 0;
+				pool->failed_logons++;
+				pool->cv.notify_all();
 				throw;
 			}
 		}
 
-		if (pool->cv.wait_until(lock, deadline) == std::cv_status::timeout) {
-			throw IOException("Oracle connection pool timeout waiting for available session");
+		waited = true;
+		pool->interactive_waiting += bulk ? 0 : 1;
+		auto status = pool->cv.wait_until(lock, deadline);
+		pool->interactive_waiting -= bulk ? 0 : 1;
+		if (status == std::cv_status::timeout) {
+			pool->timeouts++;
+			// Queued bulk acquisitions may have been held back for this one.
+			pool->cv.notify_all();
+			throw IOException("Oracle connection pool timeout waiting for available session (%llu of %llu sessions in "
+			                  "use; see oracle_pool_stats())",
+			                  static_cast<unsigned long long>(pool->total - pool->idle.size()),
+			                  static_cast<unsigned long long>(pool->limit));
+		}
+	}
+}
+
+std::shared_ptr<OracleConnectionPool> OracleConnectionManager::GetPool(const std::string &connection_string,
+                                                                       const OracleSettings &settings) {
+	// Each backend (and DRCP connection class) gets its own pool.
+	auto key = connection_string;
+	if (settings.pool_mode != "dedicated") {
+		key += "#" + settings.pool_mode + ":" + settings.connection_class;
+	} else if (!settings.session_init.empty()) {
+		// Dedicated sessions carry no OCI tag; keep sessions of different init profiles apart.
+		key += "#" + SessionTag(settings);
+	}
+	std::lock_guard<std::mutex> lock(manager_mutex);
+	auto &pool = pools[key];
+	if (!pool) {
+		pool = std::make_shared<OracleConnectionPool>();
+		pool->label = RedactPoolKey(key);
+		pool->pool_mode = settings.pool_mode;
+	}
+	return pool;
+}
+
+void OracleConnectionManager::WarmUp(const std::string &connection_string, const OracleSettings &settings) {
+	if (!settings.connection_cache || settings.min_connections == 0) {
+		return;
+	}
+	auto pool = GetPool(connection_string, settings);
+	if (settings.pool_mode != "dedicated") {
+		// OCISessionPoolCreate opens min_connections sessions itself.
+		EnsureSessionPool(*pool, connection_string, settings);
+		return;
+	}
+	idx_t count = 0;
+	{
+		std::lock_guard<std::mutex> lock(pool->lock);
+		if (settings.connection_limit > pool->limit) {
+			pool->limit = settings.connection_limit;
 		}
+		auto target = MinValue<idx_t>(settings.min_connections, pool->limit);
+		if (target > pool->total) {
+			count = target - pool->total;
+			// Reserve the slots up front, as Acquire does for a single logon.
+			pool->total += count;
+		}
+	}
+	if (count == 0) {
+		return;
+	}
+
+	// Each logon is a few network round trips; doing them concurrently costs about one logon in total.
+	auto start = std::chrono::steady_clock::now();
+	std::atomic<idx_t> failures {0};
+	std::vector<std::thread> workers;
+	for (idx_t i = 0; i < count; i++) {
+		workers.emplace_back([&]() {
+			try {
+				auto ctx = CreateConnection(connection_string, settings, pool);
+				std::lock_guard<std::mutex> lock(pool->lock);
+				pool->idle.push_back(std::move(ctx));
+				pool->creations++;
+				pool->cv.notify_all();
+			} catch (std::exception &ex) {
+				failures++;
+				std::lock_guard<std::mutex> lock(pool->lock);
+				pool->total--;
+				pool->failed_logons++;
+				pool->cv.notify_all();
+				if (DebugPool(settings)) {
+					fprintf(stderr, "[oracle] session warm-up failed: %s\n", ex.what());
+				}
+			}
+		});
+	}
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	if (DebugPool(settings)) {
+		auto elapsed =
+		    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+		fprintf(stderr, "[oracle] warmed %llu sessions (%llu failed) in %lld ms\n",
+		        static_cast<unsigned long long>(count - failures.load()),
+		        static_cast<unsigned long long>(failures.load()), static_cast<long long>(elapsed));
 	}
 }
 
-std::shared_ptr<OracleContext> OracleConnectionManager::CreateConnection(const std::string &connection_string,
-                                                                         const OracleSettings &settings) {
+std::shared_ptr<OracleContext> OracleConnectionManager::CreateConnection(
+    const std::string &connection_string, const OracleSettings &settings,
+    const std::shared_ptr<OracleConnectionPool> &pool) {
+	if (settings.pool_mode != "dedicated") {
+		return CreatePooledSession(connection_string, settings, pool);
+	}
 	auto ctx = std::make_shared<OracleContext>();
 	ctx->envhp = envhp;
 	ctx->owns_env = false;
@@ -205,30 +614,152 @@ std::shared_ptr<OracleContext> OracleConnectionManager::CreateConnection(const s
 	CheckOCIError(OCIAttrSet(ctx->svchp, OCI_HTYPE_SVCCTX, ctx->authp, 0, OCI_ATTR_SESSION, ctx->errhp), ctx->errhp,
 	              "Failed to set OCI session on service context");
 
-	// Set NLS date/timestamp format to ISO
-	{
+	InitializeSession(*ctx, settings, true);
+	ctx->session_tag = SessionTag(settings);
+	ctx->connected = true;
+	return ctx;
+}
+
+void OracleConnectionManager::EnsureSessionPool(OracleConnectionPool &pool, const std::string &connection_string,
+                                                const OracleSettings &settings) {
+	std::lock_guard<std::mutex> guard(pool.spool_lock);
+	auto sess_min = static_cast<ub4>(MinValue<idx_t>(settings.min_connections, settings.connection_limit));
+	auto sess_max = static_cast<ub4>(MaxValue<idx_t>(settings.connection_limit, 1));
+	if (pool.spoolhp && sess_max <= pool.spool_max) {
+		return;
+	}
+	std::string user, password, db;
+	ParseOracleConnectionString(connection_string, user, password, db);
+	if (settings.pool_mode == "drcp") {
+		db = DrcpConnectIdentifier(db);
+	}
+	if (pool.spoolhp) {
+		// A later SET oracle_connection_limit admits more sessions than the OCI pool holds; grow it, or the extra
+		// acquisitions would only time out in OCISessionGet.
+		CheckOCIError(OCISessionPoolCreate(envhp, pool.spool_errhp, pool.spoolhp, &pool.spool_name,
+		                                   &pool.spool_name_len, (OraText *)db.c_str(), (ub4)db.size(), sess_min,
+		                                   sess_max, 1, (OraText *)user.c_str(), (ub4)user.size(),
+		                                   (OraText *)password.c_str(), (ub4)password.size(), OCI_SPC_REINITIALIZE),
+		              pool.spool_errhp, "Failed to resize OCI session pool");
+		pool.spool_max = sess_max;
+		if (DebugPool(settings)) {
+			fprintf(stderr, "[oracle] OCI session pool resized to %u sessions\n", sess_max);
+		}
+		return;
+	}
+
+	OCIError *errhp = nullptr;
+	OCISPool *spoolhp = nullptr;
+	CheckOCIError(OCIHandleAlloc(envhp, (dvoid **)&errhp, OCI_HTYPE_ERROR, 0, nullptr), nullptr,
+	              "Failed to allocate OCI error handle");
+	auto status = OCIHandleAlloc(envhp, (dvoid **)&spoolhp, OCI_HTYPE_SPOOL, 0, nullptr);
+	if (status == OCI_SUCCESS) {
+		status = OCISessionPoolCreate(envhp, errhp, spoolhp, &pool.spool_name, &pool.spool_name_len,
+		                              (OraText *)db.c_str(), (ub4)db.size(), sess_min, sess_max, 1,
+		                              (OraText *)user.c_str(), (ub4)user.size(), (OraText *)password.c_str(),
+		                              (ub4)password.size(), OCI_SPC_HOMOGENEOUS);
+	}
+	if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO) {
+		text errbuf[512] = {0};
+		sb4 errcode = 0;
+		OCIErrorGet((dvoid *)errhp, 1, nullptr, &errcode, errbuf, (ub4)sizeof(errbuf), OCI_HTYPE_ERROR);
+		if (spoolhp) {
+			OCIHandleFree(spoolhp, OCI_HTYPE_SPOOL);
+		}
+		OCIHandleFree(errhp, OCI_HTYPE_ERROR);
+		throw IOException("Failed to create OCI session pool: " + std::string((char *)errbuf));
+	}
+	pool.spoolhp = spoolhp;
+	pool.spool_errhp = errhp;
+	pool.spool_max = sess_max;
+	// OCISessionGet blocks without a limit by default once sess_max sessions are out (e.g. connection_cache false,
+	// which bypasses the admission queue); fail after the acquire timeout instead.
+	ub1 get_mode = OCI_SPOOL_ATTRVAL_TIMEDWAIT;
+	OCIAttrSet(spoolhp, OCI_HTYPE_SPOOL, &get_mode, sizeof(get_mode), OCI_ATTR_SPOOL_GETMODE, errhp);
+	ub4 wait_timeout_ms = static_cast<ub4>(ACQUIRE_TIMEOUT_MS);
+	OCIAttrSet(spoolhp, OCI_HTYPE_SPOOL, &wait_timeout_ms, sizeof(wait_timeout_ms), OCI_ATTR_SPOOL_WAIT_TIMEOUT,
+	           errhp);
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] created OCI session pool (%s, %s)\n", settings.pool_mode.c_str(), db.c_str());
+	}
+}
+
+std::shared_ptr<OracleContext> OracleConnectionManager::CreatePooledSession(
+    const std::string &connection_string, const OracleSettings &settings,
+    const std::shared_ptr<OracleConnectionPool> &pool) {
+	EnsureSessionPool(*pool, connection_string, settings);
+
+	auto ctx = std::make_shared<OracleContext>();
+	ctx->envhp = envhp;
+	ctx->owns_env = false;
+	ctx->session_pool_owner = pool;
+	CheckOCIError(OCIHandleAlloc(ctx->envhp, (dvoid **)&ctx->errhp, OCI_HTYPE_ERROR, 0, nullptr), nullptr,
+	              "Failed to allocate OCI error handle");
+
+	OCIAuthInfo *authinfo = nullptr;
+	CheckOCIError(OCIHandleAlloc(ctx->envhp, (dvoid **)&authinfo, OCI_HTYPE_AUTHINFO, 0, nullptr), ctx->errhp,
+	              "Failed to allocate OCI auth info handle");
+	auto free_authinfo = std::unique_ptr<OCIAuthInfo, void (*)(OCIAuthInfo *)>(
+	    authinfo, [](OCIAuthInfo *handle) { OCIHandleFree(handle, OCI_HTYPE_AUTHINFO); });
+	if (settings.pool_mode == "drcp") {
+		// Sessions are shared between workers that use the same connection class; SELF purity keeps their state.
+		CheckOCIError(OCIAttrSet(authinfo, OCI_HTYPE_AUTHINFO, (dvoid *)settings.connection_class.c_str(),
+		                         (ub4)settings.connection_class.size(), OCI_ATTR_CONNECTION_CLASS, ctx->errhp),
+		              ctx->errhp, "Failed to set DRCP connection class");
+		ub4 purity = OCI_ATTR_PURITY_SELF;
+		CheckOCIError(OCIAttrSet(authinfo, OCI_HTYPE_AUTHINFO, &purity, sizeof(purity), OCI_ATTR_PURITY, ctx->errhp),
+		              ctx->errhp, "Failed to set DRCP purity");
+	}
+
+	// Ask for a session already tagged with this init profile; OCI falls back to an untagged one.
+	auto tag = SessionTag(settings);
+	OraText *ret_tag = nullptr;
+	ub4 ret_tag_len = 0;
+	boolean found = FALSE;
+	CheckOCIError(OCISessionGet(ctx->envhp, ctx->errhp, &ctx->svchp, authinfo, pool->spool_name,
+	                            pool->spool_name_len, (OraText *)tag.c_str(), (ub4)tag.size(), &ret_tag, &ret_tag_len,
+	                            &found, OCI_SESSGET_SPOOL),
+	              ctx->errhp, "Failed to get session from OCI session pool");
+	ctx->session_pooled = true;
+	OCIAttrGet(ctx->svchp, OCI_HTYPE_SVCCTX, &ctx->srvhp, nullptr, OCI_ATTR_SERVER, ctx->errhp);
+	OCIAttrGet(ctx->svchp, OCI_HTYPE_SVCCTX, &ctx->authp, nullptr, OCI_ATTR_SESSION, ctx->errhp);
+	if (found && DebugPool(settings)) {
+		fprintf(stderr, "[oracle] reusing pooled session tagged %s\n", tag.c_str());
+	}
+
+	InitializeSession(*ctx, settings, !found);
+	// Tag only after the profile ran, so a failed init never leaves a mislabelled session in the pool.
+	ctx->session_tag = tag;
+	ctx->connected = true;
+	return ctx;
+}
+
+void OracleConnectionManager::InitializeSession(OracleContext &ctx, const OracleSettings &settings,
+                                                bool run_profile) {
+	// NLS date/timestamp format to ISO plus the session_init profile, in one round trip
+	if (run_profile) {
 		OCIStmt *stmt = nullptr;
-		CheckOCIError(OCIHandleAlloc(ctx->envhp, (dvoid **)&stmt, OCI_HTYPE_STMT, 0, nullptr), ctx->errhp,
-		              "Failed to allocate statement handle for NLS setup");
-		std::string sql = "ALTER SESSION SET NLS_DATE_FORMAT = 'YYYY-MM-DD HH24:MI:SS' NLS_TIMESTAMP_FORMAT = "
-		                  "'YYYY-MM-DD HH24:MI:SS.FF'";
-		CheckOCIError(OCIStmtPrepare(stmt, ctx->errhp, (OraText *)sql.c_str(), sql.size(), OCI_NTV_SYNTAX, OCI_DEFAULT),
-		              ctx->errhp, "Failed to prepare NLS setup statement");
-		CheckOCIError(OCIStmtExecute(ctx->svchp, stmt, ctx->errhp, 1, 0, nullptr, nullptr, OCI_DEFAULT), ctx->errhp,
-		              "Failed to execute NLS setup statement");
-		OCIHandleFree(stmt, OCI_HTYPE_STMT);
+		CheckOCIError(OCIHandleAlloc(ctx.envhp, (dvoid **)&stmt, OCI_HTYPE_STMT, 0, nullptr), ctx.errhp,
+		              "Failed to allocate statement handle for session setup");
+		auto free_stmt = std::unique_ptr<OCIStmt, void (*)(OCIStmt *)>(
+		    stmt, [](OCIStmt *handle) { OCIHandleFree(handle, OCI_HTYPE_STMT); });
+		auto sql = SessionInitBlock(settings);
+		if (!settings.session_init.empty() && DebugPool(settings)) {
+			fprintf(stderr, "[oracle] session init: %s\n", sql.c_str());
+		}
+		CheckOCIError(OCIStmtPrepare(stmt, ctx.errhp, (OraText *)sql.c_str(), sql.size(), OCI_NTV_SYNTAX, OCI_DEFAULT),
+		              ctx.errhp, "Failed to prepare session setup block");
+		CheckOCIError(OCIStmtExecute(ctx.svchp, stmt, ctx.errhp, 1, 0, nullptr, nullptr, OCI_DEFAULT), ctx.errhp,
+		              "Failed to execute session setup (check oracle_session_init)");
 	}
 
 	// Enable statement cache (Disable for debugging shift issue)
 	ub4 stmt_cache_size = 0;
-	OCIAttrSet(ctx->svchp, OCI_HTYPE_SVCCTX, &stmt_cache_size, 0, OCI_ATTR_STMTCACHESIZE, ctx->errhp);
+	OCIAttrSet(ctx.svchp, OCI_HTYPE_SVCCTX, &stmt_cache_size, 0, OCI_ATTR_STMTCACHESIZE, ctx.errhp);
 
 	// Default call timeout for operations on this service context
 	ub4 svc_call_timeout_ms = 30000;
-	OCIAttrSet(ctx->svchp, OCI_HTYPE_SVCCTX, &svc_call_timeout_ms, 0, OCI_ATTR_CALL_TIMEOUT, ctx->errhp);
-
-	ctx->connected = true;
-	return ctx;
+	OCIAttrSet(ctx.svchp, OCI_HTYPE_SVCCTX, &svc_call_timeout_ms, 0, OCI_ATTR_CALL_TIMEOUT, ctx.errhp);
 }
 
 } // namespace duckdb
@@ -19,11 +19,17 @@
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 #include "oracle_storage_extension.hpp"
+#include <algorithm>
 #include <chrono>
+#include <list>
 #include <mutex>
 #include <unordered_map>
 #include <condition_variable>
+#include <deque>
+#include <future>
+#include <thread>
 #include "oracle_table_function.hpp"
 #include "oracle_catalog_state.hpp"
 #include "oracle_secret.hpp"
@@ -94,6 +100,11 @@ unique_ptr<FunctionData> OracleBindData::Copy() const {
 	copy->original_names = original_names;
 	copy->settings = settings;
 	copy->stmt = stmt; // Copy shared pointer
+	copy->table_stats = table_stats;
+	copy->pushed_filter_count = pushed_filter_count;
+	copy->pushed_equality_columns = pushed_equality_columns;
+	copy->unique_keys = unique_keys;
+	copy->catalog_metadata = catalog_metadata;
 	return std::move(copy);
 }
 
@@ -142,7 +153,15 @@ static bool PathIsDirectory(const string &path) {
 	return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
 }
 
-static OracleSettings GetOracleSettings(ClientContext &context, OracleCatalogState *state) {
+static string ParseScanPriority(const string &value) {
+	auto priority = StringUtil::Lower(value);
+	if (priority != "bulk" && priority != "interactive") {
+		throw InvalidInputException("oracle_scan_priority must be 'bulk' or 'interactive', got '%s'", value);
+	}
+	return priority;
+}
+
+OracleSettings GetOracleSettings(ClientContext &context, OracleCatalogState *state) {
 	OracleSettings settings;
 	if (state) {
 		settings = state->settings;
@@ -160,6 +179,26 @@ static OracleSettings GetOracleSettings(ClientContext &context, OracleCatalogSta
 		auto val = option_value.GetValue<int64_t>();
 		settings.prefetch_memory = val <= 0 ? 0 : static_cast<idx_t>(val);
 	}
+	if (context.TryGetCurrentSetting("oracle_adaptive_prefetch", option_value)) {
+		settings.adaptive_prefetch = option_value.GetValue<bool>();
+	}
+	if (context.TryGetCurrentSetting("oracle_fetch_target_bytes", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.fetch_target_bytes = MaxValue<idx_t>(1, static_cast<idx_t>(val));
+	}
+	if (context.TryGetCurrentSetting("oracle_read_ahead", option_value)) {
+		settings.read_ahead = option_value.GetValue<bool>();
+	}
+	if (context.TryGetCurrentSetting("oracle_io_threads", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.io_threads = MaxValue<idx_t>(1, static_cast<idx_t>(val));
+	}
+	if (context.TryGetCurrentSetting("oracle_speculative_execute", option_value)) {
+		settings.speculative_execute = option_value.GetValue<bool>();
+	}
+	if (context.TryGetCurrentSetting("oracle_point_lookup", option_value)) {
+		settings.point_lookup = option_value.GetValue<bool>();
+	}
 	if (context.TryGetCurrentSetting("oracle_array_size", option_value)) {
 		auto val = option_value.GetValue<int64_t>();
 		settings.array_size = MaxValue<idx_t>(1, static_cast<idx_t>(val));
@@ -171,6 +210,36 @@ static OracleSettings GetOracleSettings(ClientContext &context, OracleCatalogSta
 		auto val = option_value.GetValue<int64_t>();
 		settings.connection_limit = MaxValue<idx_t>(1, static_cast<idx_t>(val));
 	}
+	if (context.TryGetCurrentSetting("oracle_min_connections", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.min_connections = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
+	if (context.TryGetCurrentSetting("oracle_connection_max_idle_time", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.connection_max_idle_time = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
+	if (context.TryGetCurrentSetting("oracle_connection_max_lifetime", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.connection_max_lifetime = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
+	if (context.TryGetCurrentSetting("oracle_connection_validation_interval", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.connection_validation_interval = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
+	if (context.TryGetCurrentSetting("oracle_reserved_connections", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.reserved_connections = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
+	if (context.TryGetCurrentSetting("oracle_bulk_connection_limit", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.bulk_connection_limit = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
+	if (context.TryGetCurrentSetting("oracle_scan_priority", option_value)) {
+		settings.scan_priority = ParseScanPriority(option_value.ToString());
+	}
+	if (context.TryGetCurrentSetting("oracle_session_init", option_value) && !option_value.ToString().empty()) {
+		settings.session_init = option_value.ToString();
+	}
 	if (context.TryGetCurrentSetting("oracle_debug_show_queries", option_value)) {
 		settings.debug_show_queries = option_value.GetValue<bool>();
 	}
@@ -190,6 +259,16 @@ static OracleSettings GetOracleSettings(ClientContext &context, OracleCatalogSta
 	if (context.TryGetCurrentSetting("oracle_enable_spatial_types", option_value)) {
 		settings.enable_spatial_types = option_value.GetValue<bool>();
 	}
+	if (context.TryGetCurrentSetting("oracle_enable_statistics", option_value)) {
+		settings.enable_statistics = option_value.GetValue<bool>();
+	}
+	if (context.TryGetCurrentSetting("oracle_explain_cardinality", option_value)) {
+		settings.explain_cardinality = option_value.GetValue<bool>();
+	}
+	if (context.TryGetCurrentSetting("oracle_describe_cache_size", option_value)) {
+		auto val = option_value.GetValue<int64_t>();
+		settings.describe_cache_size = val <= 0 ? 0 : static_cast<idx_t>(val);
+	}
 	return settings;
 }
 
@@ -279,20 +358,129 @@ static void OracleExecuteFunction(DataChunk &args, ExpressionState &state, Vecto
 	}
 }
 
+namespace {
+//! Result shape of an OCI describe, as stored in the describe cache.
+struct OracleDescribeResult {
+	vector<string> names;
+	vector<LogicalType> types;
+	vector<ub2> oci_types;
+	vector<ub4> oci_sizes;
+};
+
+//! LRU cache of describe results keyed by connection string and SQL text.
+struct OracleDescribeCache {
+	std::mutex lock;
+	std::list<pair<string, shared_ptr<OracleDescribeResult>>> entries;
+	unordered_map<string, std::list<pair<string, shared_ptr<OracleDescribeResult>>>::iterator> index;
+
+	shared_ptr<OracleDescribeResult> Get(const string &key) {
+		lock_guard<std::mutex> guard(lock);
+		auto entry = index.find(key);
+		if (entry == index.end()) {
+			return nullptr;
+		}
+		entries.splice(entries.begin(), entries, entry->second);
+		return entry->second->second;
+	}
+
+	void Put(const string &key, shared_ptr<OracleDescribeResult> result, idx_t capacity) {
+		lock_guard<std::mutex> guard(lock);
+		auto entry = index.find(key);
+		if (entry != index.end()) {
+			entries.erase(entry->second);
+			index.erase(entry);
+		}
+		entries.emplace_front(key, std::move(result));
+		index[key] = entries.begin();
+		while (entries.size() > capacity) {
+			index.erase(entries.back().first);
+			entries.pop_back();
+		}
+	}
+
+	void Clear() {
+		lock_guard<std::mutex> guard(lock);
+		entries.clear();
+		index.clear();
+	}
+};
+
+static OracleDescribeCache &DescribeCache() {
+	static OracleDescribeCache cache;
+	return cache;
+}
+} // namespace
+
+static unique_ptr<OracleBindData> InitializeBindData(ClientContext &context, const string &connection_string,
+                                                     const string &query, OracleBindData *bind_data_ptr,
+                                                     OracleCatalogState *state) {
+	auto result = bind_data_ptr ? unique_ptr<OracleBindData>(bind_data_ptr) : make_uniq<OracleBindData>();
+	result->connection_string = connection_string;
+	result->base_query = query;
+	result->query = query;
+	result->settings = GetOracleSettings(context, state);
+	result->finished = false;
+	return result;
+}
+
+static void ApplyDescribeResult(OracleBindData &bind, const OracleDescribeResult &describe,
+                                vector<LogicalType> &return_types, vector<string> &names) {
+	names = describe.names;
+	return_types = describe.types;
+	bind.column_names = describe.names;
+	bind.oci_types = describe.oci_types;
+	bind.oci_sizes = describe.oci_sizes;
+	bind.original_names = describe.names;
+	bind.original_types = describe.types;
+}
+
+unique_ptr<FunctionData> OracleBindDescribed(ClientContext &context, string connection_string, string query,
+                                             const vector<string> &names, const vector<LogicalType> &types,
+                                             const vector<ub2> &oci_types, const vector<ub4> &oci_sizes,
+                                             OracleBindData *bind_data_ptr, OracleCatalogState *state) {
+	auto result = InitializeBindData(context, connection_string, query, bind_data_ptr, state);
+	if (result->settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] bind from catalog metadata (no describe): %s\n", query.c_str());
+	}
+	result->column_names = names;
+	result->original_names = names;
+	result->original_types = types;
+	result->oci_types = oci_types;
+	result->oci_sizes = oci_sizes;
+	result->catalog_metadata = true;
+	return std::move(result);
+}
+
+void OracleClearDescribeCache() {
+	DescribeCache().Clear();
+}
+
 unique_ptr<FunctionData> OracleBindInternal(ClientContext &context, string connection_string, string query,
                                             vector<LogicalType> &return_types, vector<string> &names,
                                             OracleBindData *bind_data_ptr /* = nullptr */,
                                             OracleCatalogState *state /* = nullptr */) {
-	auto result = bind_data_ptr ? unique_ptr<OracleBindData>(bind_data_ptr) : make_uniq<OracleBindData>();
-	result->connection_string = connection_string;
+	auto result = InitializeBindData(context, connection_string, query, bind_data_ptr, state);
 
 	// Clear output vectors - they will be populated from OCI describe below.
 	// This prevents duplication when caller pre-populates vectors (e.g., GetScanFunction).
 	names.clear();
 	return_types.clear();
-	result->base_query = query;
-	result->query = query;
-	result->settings = GetOracleSettings(context, state);
+
+	// Repeated binds of the same SQL (plan re-binds, dashboards) reuse the describe without a round trip. Only binds
+	// through an attached database are cached: its DDL watch drops the cache, nothing does for raw connection strings.
+	auto cache_key = connection_string + "\n" + query;
+	bool use_describe_cache = state && result->settings.describe_cache_size > 0;
+	if (use_describe_cache) {
+		auto cached = DescribeCache().Get(cache_key);
+		if (cached) {
+			if (result->settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+				fprintf(stderr, "[oracle] describe cache hit: %s\n", query.c_str());
+			}
+			ApplyDescribeResult(*result, *cached, return_types, names);
+			return std::move(result);
+		}
+	}
+
 	if (getenv("ORACLE_DEBUG")) {
 		fprintf(stderr, "[oracle] raw connection: %s\n", connection_string.c_str());
 	}
@@ -430,12 +618,20 @@ unique_ptr<FunctionData> OracleBindInternal(ClientContext &context, string conne
 
 		result->original_types = return_types;
 		result->original_names = names;
-		result->finished = false;
 
 		// Reset handles to avoid holding connections in plan cache
 		result->stmt.reset();
 		result->conn_handle.reset();
 
+		if (use_describe_cache) {
+			auto describe = make_shared_ptr<OracleDescribeResult>();
+			describe->names = names;
+			describe->types = return_types;
+			describe->oci_types = result->oci_types;
+			describe->oci_sizes = result->oci_sizes;
+			DescribeCache().Put(cache_key, std::move(describe), result->settings.describe_cache_size);
+		}
+
 		return std::move(result);
 	} catch (...) {
 		throw;
@@ -458,17 +654,339 @@ static unique_ptr<FunctionData> OracleQueryBind(ClientContext &context, TableFun
 	auto connection_string = input.inputs[0].GetValue<string>();
 
 	// Support attached DB alias: if no '@' present, treat as alias of an attached Oracle database.
+	shared_ptr<OracleCatalogState> state;
 	if (connection_string.find('@') == string::npos) {
-		auto state = OracleCatalogState::LookupByAlias(connection_string);
+		state = OracleCatalogState::LookupByAlias(connection_string);
 		if (state) {
 			connection_string = state->connection_string;
+			// Polls for DDL when due, which drops describe results cached before it.
+			state->GetCatalogVersion();
 		}
 	}
 
 	auto query = input.inputs[1].GetValue<string>();
+	return OracleBindInternal(context, connection_string, query, return_types, names, nullptr, state.get());
+}
+
+//! oracle_scan_changes(conn, schema, table, since_scn [, flashback := false])
+//! Returns rows changed after since_scn plus ORA_OPERATION, ORA_SCN and ORA_HIGH_WATER_SCN columns.
+//! Default mode filters on ORA_ROWSCN (block-level unless the table uses ROWDEPENDENCIES, so it may return a
+//! superset but never misses a change) and reports every row as 'U' (upsert). With flashback := true the
+//! extraction uses VERSIONS BETWEEN SCN, which distinguishes I/U/D and includes deleted keys, but requires undo
+//! retention covering since_scn.
+static unique_ptr<FunctionData> OracleScanChangesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	auto connection_string = input.inputs[0].GetValue<string>();
+	if (connection_string.find('@') == string::npos) {
+		auto state = OracleCatalogState::LookupByAlias(connection_string);
+		if (state) {
+			connection_string = state->connection_string;
+		}
+	}
+	auto schema_name = input.inputs[1].GetValue<string>();
+	auto table_name = input.inputs[2].GetValue<string>();
+	auto since_scn = input.inputs[3].GetValue<int64_t>();
+	if (since_scn < 0) {
+		throw BinderException("oracle_scan_changes: since_scn must be non-negative");
+	}
+
+	bool use_flashback = false;
+	auto flashback_entry = input.named_parameters.find("flashback");
+	if (flashback_entry != input.named_parameters.end()) {
+		use_flashback = flashback_entry->second.GetValue<bool>();
+	}
+
+	// Capture the high-water mark before reading so that changes committed during the extraction are picked up
+	// again by the next run (at-least-once delivery) instead of being lost.
+	OracleConnection scn_conn;
+	scn_conn.Connect(connection_string);
+	auto high_water_scn = scn_conn.GetCurrentScn();
+
+	auto quoted_schema = KeywordHelper::WriteQuoted(schema_name, '"');
+	auto quoted_table = KeywordHelper::WriteQuoted(table_name, '"');
+	string query;
+	if (use_flashback) {
+		query = StringUtil::Format(
+		    "SELECT CAST(NVL(VERSIONS_OPERATION, 'U') AS VARCHAR2(1)) AS \"ORA_OPERATION\", "
+		    "CAST(VERSIONS_STARTSCN AS NUMBER(18)) AS \"ORA_SCN\", CAST(%lld AS NUMBER(18)) AS \"ORA_HIGH_WATER_SCN\", "
+		    "t.* FROM %s.%s VERSIONS BETWEEN SCN %lld AND %lld t "
+		    "WHERE VERSIONS_STARTSCN > %lld AND VERSIONS_ENDSCN IS NULL",
+		    high_water_scn, quoted_schema.c_str(), quoted_table.c_str(), since_scn, high_water_scn, since_scn);
+	} else {
+		// ORA_ROWSCN is not supported in flashback (AS OF) queries, so the scan reads current data.
+		query = StringUtil::Format("SELECT CAST('U' AS VARCHAR2(1)) AS \"ORA_OPERATION\", "
+		                           "CAST(ORA_ROWSCN AS NUMBER(18)) AS \"ORA_SCN\", "
+		                           "CAST(%lld AS NUMBER(18)) AS \"ORA_HIGH_WATER_SCN\", t.* FROM %s.%s t "
+		                           "WHERE ORA_ROWSCN > %lld",
+		                           high_water_scn, quoted_schema.c_str(), quoted_table.c_str(), since_scn);
+	}
 	return OracleBindInternal(context, connection_string, query, return_types, names);
 }
 
+namespace {
+//! Shared I/O threads running read-ahead fetches or speculative executes, so a DuckDB worker converts one batch while
+//! the next one is on the wire. io_threads bounds the number of calls of each kind in flight across all scans; threads
+//! are started on demand and live for the process.
+class OracleFetchDriver {
+public:
+	//! Read-ahead fetches: short calls a DuckDB worker is about to wait for.
+	static OracleFetchDriver &Fetches() {
+		static auto *instance = new OracleFetchDriver();
+		return *instance;
+	}
+	//! Speculative executes hold a thread for the whole server-side execution, so they get threads of their own and
+	//! never queue read-ahead fetches behind a slow query.
+	static OracleFetchDriver &Executes() {
+		static auto *instance = new OracleFetchDriver();
+		return *instance;
+	}
+
+	std::future<std::pair<sword, ub4>> Submit(idx_t threads, std::function<std::pair<sword, ub4>()> fetch) {
+		auto task = std::make_shared<std::packaged_task<std::pair<sword, ub4>()>>(std::move(fetch));
+		auto result = task->get_future();
+		lock_guard<std::mutex> guard(lock);
+		tasks.push_back([task]() { (*task)(); });
+		for (; workers < threads; workers++) {
+			std::thread([this]() { Run(); }).detach();
+		}
+		cv.notify_one();
+		return result;
+	}
+
+private:
+	void Run() {
+		std::unique_lock<std::mutex> guard(lock);
+		while (true) {
+			cv.wait(guard, [&]() { return !tasks.empty(); });
+			auto task = std::move(tasks.front());
+			tasks.pop_front();
+			guard.unlock();
+			task();
+			guard.lock();
+		}
+	}
+
+	std::mutex lock;
+	std::condition_variable cv;
+	std::deque<std::function<void()>> tasks;
+	idx_t workers = 0;
+};
+} // namespace
+
+//! Point the defines at a buffer set (local calls, no round trip).
+static void BindDefines(OracleScanState &state, vector<vector<char>> &buffers, vector<vector<sb2>> &indicators,
+                        vector<vector<ub2>> &return_lens) {
+	for (idx_t col_idx = 0; col_idx < state.defines.size(); col_idx++) {
+		auto size = state.define_sizes[col_idx];
+		CheckOCIError(OCIDefineByPos(state.stmt.get(), &state.defines[col_idx], state.err, col_idx + 1,
+		                             buffers[col_idx].data(), size, state.define_types[col_idx],
+		                             indicators[col_idx].data(), return_lens[col_idx].data(), nullptr, OCI_DEFAULT),
+		              state.err, "Failed to define OCI column");
+		CheckOCIError(OCIDefineArrayOfStruct(state.defines[col_idx], state.err, size, sizeof(sb2), sizeof(ub2), 0),
+		              state.err, "Failed to set OCI array of struct");
+	}
+}
+
+//! Fetch the next batch into whichever buffers the defines point at; returns the status and rows fetched.
+static std::pair<sword, ub4> FetchBatch(ClientContext &context, OracleScanState &state, OracleContext &ctx) {
+	// An interrupt breaks a blocked fetch instead of waiting for Oracle.
+	OracleInterruptGuard interrupt_guard(context, ctx);
+	auto status = OCIStmtFetch2(state.stmt.get(), ctx.errhp, state.fetch_rows, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
+	if (interrupt_guard.Broken()) {
+		throw InterruptException();
+	}
+	if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO && status != OCI_NO_DATA) {
+		CheckOCIError(status, ctx.errhp, "Failed to fetch OCI data");
+	}
+	ub4 rows_fetched = 0;
+	OCIAttrGet(state.stmt.get(), OCI_HTYPE_STMT, &rows_fetched, 0, OCI_ATTR_ROWS_FETCHED, ctx.errhp);
+	return std::make_pair(status, rows_fetched);
+}
+
+//! Open the cursor; with iters > 0 the same round trip fetches the first batch into the defines.
+static std::pair<sword, ub4> ExecuteCursor(ClientContext &context, OracleScanState &state, OracleContext &ctx,
+                                           ub4 iters) {
+	// An interrupt breaks a blocked execute instead of waiting for Oracle.
+	OracleInterruptGuard interrupt_guard(context, ctx);
+	auto status = OCIStmtExecute(ctx.svchp, state.stmt.get(), ctx.errhp, iters, 0, nullptr, nullptr, OCI_DEFAULT);
+	if (interrupt_guard.Broken()) {
+		throw InterruptException();
+	}
+	if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO && !(iters > 0 && status == OCI_NO_DATA)) {
+		CheckOCIError(status, ctx.errhp, "Failed to execute OCI statement (open cursor)");
+	}
+	ub4 rows_fetched = 0;
+	if (iters > 0) {
+		OCIAttrGet(state.stmt.get(), OCI_HTYPE_STMT, &rows_fetched, 0, OCI_ATTR_ROWS_FETCHED, ctx.errhp);
+	}
+	return std::make_pair(status, rows_fetched);
+}
+
+OracleScanState::~OracleScanState() {
+	WaitForPending();
+}
+
+void OracleScanState::WaitForPending() {
+	if (pending_execute.valid()) {
+		if (pending_execute.wait_for(std::chrono::seconds(0)) != std::future_status::ready && svc) {
+			// The scan is torn down before reading its speculative cursor: stop Oracle's work instead of waiting.
+			OCIError *break_err = nullptr;
+			if (OCIHandleAlloc(OracleConnectionManager::Instance().Env(), (dvoid **)&break_err, OCI_HTYPE_ERROR, 0,
+			                   nullptr) == OCI_SUCCESS) {
+				OCIBreak(svc, break_err);
+				pending_execute.wait();
+				OCIReset(svc, break_err);
+				OCIHandleFree(break_err, OCI_HTYPE_ERROR);
+			}
+		}
+		pending_execute.wait();
+		pending_execute = std::future<std::pair<sword, ub4>>();
+	}
+	if (pending_fetch.valid()) {
+		pending_fetch.wait();
+		pending_fetch = std::future<std::pair<sword, ub4>>();
+	}
+}
+
+//! Start fetching the next batch into the read-ahead buffers on an I/O thread.
+static void StartReadAhead(ClientContext &context, const OracleBindData &bind, OracleScanState &state,
+                           std::shared_ptr<OracleContext> ctx) {
+	if (state.ahead_buffers.empty()) {
+		state.ahead_buffers.resize(state.buffers.size());
+		state.ahead_indicators.resize(state.indicators.size());
+		state.ahead_return_lens.resize(state.return_lens.size());
+		for (idx_t col_idx = 0; col_idx < state.buffers.size(); col_idx++) {
+			state.ahead_buffers[col_idx].resize(state.buffers[col_idx].size());
+			state.ahead_indicators[col_idx].resize(state.indicators[col_idx].size());
+			state.ahead_return_lens[col_idx].resize(state.return_lens[col_idx].size());
+		}
+	}
+	BindDefines(state, state.ahead_buffers, state.ahead_indicators, state.ahead_return_lens);
+	auto state_ptr = &state;
+	state.pending_fetch = OracleFetchDriver::Fetches().Submit(
+	    bind.settings.io_threads, [&context, state_ptr, ctx]() { return FetchBatch(context, *state_ptr, *ctx); });
+}
+
+namespace {
+//! Fetch sizing picked by adaptive prefetch, remembered per connection string and base query (i.e. per table).
+struct OracleFetchProfile {
+	ub4 fetch_rows = STANDARD_VECTOR_SIZE;
+	ub4 prefetch_rows = 0;
+};
+
+struct OracleFetchProfileCache {
+	static constexpr idx_t MAX_ENTRIES = 4096;
+	std::mutex lock;
+	unordered_map<string, OracleFetchProfile> entries;
+};
+
+static OracleFetchProfileCache &FetchProfileCache() {
+	static OracleFetchProfileCache cache;
+	return cache;
+}
+} // namespace
+
+//! Fetch calls sampled before adaptive prefetch picks a profile.
+static constexpr idx_t ADAPTIVE_SAMPLE_FETCHES = 2;
+//! Prefetch memory cap of adaptive prefetch when oracle_prefetch_memory is not set.
+static constexpr idx_t ADAPTIVE_DEFAULT_MEMORY_CAP = 16 * 1024 * 1024;
+
+static string FetchProfileKey(const OracleBindData &bind) {
+	return bind.connection_string + "\n" + bind.base_query;
+}
+
+static idx_t AdaptiveMemoryCap(const OracleSettings &settings) {
+	return settings.prefetch_memory > 0 ? settings.prefetch_memory : ADAPTIVE_DEFAULT_MEMORY_CAP;
+}
+
+static void ApplyFetchProfile(OracleScanState &state, const OracleSettings &settings,
+                              const OracleFetchProfile &profile) {
+	state.fetch_rows = profile.fetch_rows;
+	ub4 prefetch_rows = profile.prefetch_rows;
+	OCIAttrSet(state.stmt.get(), OCI_HTYPE_STMT, &prefetch_rows, 0, OCI_ATTR_PREFETCH_ROWS, state.err);
+	ub4 prefetch_mem = static_cast<ub4>(AdaptiveMemoryCap(settings));
+	OCIAttrSet(state.stmt.get(), OCI_HTYPE_STMT, &prefetch_mem, 0, OCI_ATTR_PREFETCH_MEMORY, state.err);
+}
+
+//! Rows per round trip = target bytes / measured row width. Links slower than 5ms per round trip get a proportionally
+//! larger target (up to 8x), and the prefetch buffer never exceeds the memory cap.
+static OracleFetchProfile TuneFetchProfile(const OracleSettings &settings, double bytes_per_row,
+                                           double round_trip_seconds) {
+	auto latency_factor = MinValue(MaxValue(round_trip_seconds / 0.005, 1.0), 8.0);
+	auto target = MinValue(static_cast<double>(settings.fetch_target_bytes) * latency_factor,
+	                       static_cast<double>(AdaptiveMemoryCap(settings)));
+	auto rows = MaxValue<idx_t>(static_cast<idx_t>(target / MaxValue(bytes_per_row, 1.0)), 1);
+	OracleFetchProfile profile;
+	profile.fetch_rows = static_cast<ub4>(MinValue<idx_t>(rows, STANDARD_VECTOR_SIZE));
+	profile.prefetch_rows = static_cast<ub4>(MinValue<idx_t>(rows, NumericLimits<ub4>::Maximum()));
+	return profile;
+}
+
+//! Account one fetch for adaptive prefetch; after enough samples (or at end of data) pick, apply and remember a
+//! profile for the table.
+static void SampleFetch(const OracleBindData &bind, OracleScanState &state, ub4 rows_fetched, bool last) {
+	for (auto &lens : state.return_lens) {
+		for (idx_t row = 0; row < rows_fetched && row < lens.size(); row++) {
+			state.sampled_bytes += lens[row];
+		}
+	}
+	state.sampled_rows += rows_fetched;
+	state.sampled_fetches++;
+	if (state.sampled_fetches < ADAPTIVE_SAMPLE_FETCHES && !last) {
+		return;
+	}
+	state.tuned = true;
+	if (state.sampled_rows == 0) {
+		return;
+	}
+	auto bytes_per_row = static_cast<double>(state.sampled_bytes) / static_cast<double>(state.sampled_rows);
+	auto profile = TuneFetchProfile(bind.settings, bytes_per_row, state.round_trip_seconds);
+	if (bind.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] adaptive prefetch: %.0f bytes/row, rtt %.2f ms -> fetch %u rows, prefetch %u rows\n",
+		        bytes_per_row, state.round_trip_seconds * 1000.0, (unsigned)profile.fetch_rows,
+		        (unsigned)profile.prefetch_rows);
+	}
+	{
+		auto &cache = FetchProfileCache();
+		lock_guard<std::mutex> guard(cache.lock);
+		if (cache.entries.size() >= OracleFetchProfileCache::MAX_ENTRIES) {
+			cache.entries.clear();
+		}
+		cache.entries[FetchProfileKey(bind)] = profile;
+	}
+	if (!last) {
+		ApplyFetchProfile(state, bind.settings, profile);
+	}
+}
+
+static void ClearFetchProfileCache() {
+	auto &cache = FetchProfileCache();
+	lock_guard<std::mutex> guard(cache.lock);
+	cache.entries.clear();
+}
+
+//! A catalog-table scan whose pushed `=` predicates cover a primary or unique key returns at most one row
+//! (oracle_point_lookup); range and non-key filters still scan.
+static bool IsPointLookup(const OracleBindData &bind) {
+	if (!bind.settings.point_lookup || !bind.catalog_metadata || bind.pushed_equality_columns.empty()) {
+		return false;
+	}
+	auto &equalities = bind.pushed_equality_columns;
+	for (auto &key : bind.unique_keys) {
+		bool covered = !key.empty();
+		for (auto &column : key) {
+			if (std::find(equalities.begin(), equalities.end(), column) == equalities.end()) {
+				covered = false;
+				break;
+			}
+		}
+		if (covered) {
+			return true;
+		}
+	}
+	return false;
+}
+
 unique_ptr<GlobalTableFunctionState> OracleInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	auto &bind = input.bind_data->Cast<OracleBindData>();
 	auto state = make_uniq<OracleScanState>(bind.column_names.size());
@@ -524,7 +1042,11 @@ unique_ptr<GlobalTableFunctionState> OracleInitGlobal(ClientContext &context, Ta
 
 	state->conn_handle = bind.conn_handle;
 	if (!state->conn_handle) {
-		state->conn_handle = OracleConnectionManager::Instance().Acquire(bind.connection_string, bind.settings);
+		// Scans are bulk work unless oracle_scan_priority says otherwise; they yield to catalog lookups and binds.
+		auto priority = bind.settings.scan_priority == "interactive" ? OracleAcquirePriority::INTERACTIVE
+		                                                             : OracleAcquirePriority::BULK;
+		state->conn_handle =
+		    OracleConnectionManager::Instance().Acquire(bind.connection_string, bind.settings, priority);
 	}
 
 	auto ctx = state->conn_handle->Get();
@@ -654,6 +1176,8 @@ unique_ptr<GlobalTableFunctionState> OracleInitGlobal(ClientContext &context, Ta
 			}
 		}
 		state->buffers[col_idx].resize(size * STANDARD_VECTOR_SIZE);
+		state->define_sizes[col_idx] = size;
+		state->define_types[col_idx] = type;
 
 		CheckOCIError(OCIDefineByPos(state->stmt.get(), &state->defines[col_idx], state->err, col_idx + 1,
 
@@ -668,6 +1192,47 @@ unique_ptr<GlobalTableFunctionState> OracleInitGlobal(ClientContext &context, Ta
 		              state->err, "Failed to set OCI array of struct");
 	}
 	state->defines_bound = true;
+
+	// A filtered scan of a catalog table is usually a key lookup: open the cursor and fetch in a single round trip,
+	// and skip the round-trip probe of adaptive prefetch, which would cost as much as the lookup itself.
+	state->point_lookup = IsPointLookup(bind);
+	if (bind.settings.adaptive_prefetch && !state->point_lookup) {
+		bool cached = false;
+		OracleFetchProfile profile;
+		{
+			auto &cache = FetchProfileCache();
+			lock_guard<std::mutex> guard(cache.lock);
+			auto entry = cache.entries.find(FetchProfileKey(bind));
+			if (entry != cache.entries.end()) {
+				profile = entry->second;
+				cached = true;
+			}
+		}
+		if (cached) {
+			ApplyFetchProfile(*state, bind.settings, profile);
+		} else {
+			// One OCIPing gives the link's round-trip time; row width is sampled from the first fetches.
+			auto start = std::chrono::steady_clock::now();
+			if (OCIPing(ctx->svchp, ctx->errhp, OCI_DEFAULT) == OCI_SUCCESS) {
+				state->round_trip_seconds =
+				    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			}
+			state->tuned = false;
+		}
+	}
+
+	if (bind.settings.speculative_execute) {
+		// Open the cursor and fetch the first batch while DuckDB finishes initializing the rest of the plan; the
+		// first OracleQueryFunction call picks the result up instead of paying for the round trips itself.
+		if (bind.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+			fprintf(stderr, "[oracle] executing SQL (speculative): %s\n", bind.query.c_str());
+		}
+		auto state_ptr = state.get();
+		state->pending_execute = OracleFetchDriver::Executes().Submit(
+		    bind.settings.io_threads, [&context, state_ptr, ctx]() {
+			    return ExecuteCursor(context, *state_ptr, *ctx, state_ptr->fetch_rows);
+		    });
+	}
 	return std::move(state);
 }
 
@@ -746,141 +1311,175 @@ void OracleQueryFunction(ClientContext &context, TableFunctionInput &data, DataC
 	auto ctx = gstate.conn_handle->Get();
 	sword status;
 	idx_t row_count = 0;
+	ub4 rows_fetched = 0;
 
 	try {
+		std::pair<sword, ub4> fetched;
+		bool have_batch = false;
 		// Execute cursor once
 		if (!gstate.executed) {
-			if (bind_data.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
-				fprintf(stderr, "[oracle] executing SQL (once): %s\n", bind_data.query.c_str());
+			if (gstate.pending_execute.valid()) {
+				// Speculative execute from OracleInitGlobal; its first batch is already in the define buffers.
+				fetched = gstate.pending_execute.get();
+				have_batch = true;
+			} else {
+				if (bind_data.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+					fprintf(stderr, "[oracle] executing SQL (once): %s\n", bind_data.query.c_str());
+				}
+				if (gstate.point_lookup) {
+					fetched = ExecuteCursor(context, gstate, *ctx, gstate.fetch_rows);
+					have_batch = true;
+				} else {
+					ExecuteCursor(context, gstate, *ctx, 0);
+				}
 			}
-			status = OCIStmtExecute(ctx->svchp, gstate.stmt.get(), ctx->errhp, 0, 0, nullptr, nullptr, OCI_DEFAULT);
-			CheckOCIError(status, ctx->errhp, "Failed to execute OCI statement (open cursor)");
 			gstate.executed = true;
 		}
 
-		ub4 rows_fetched = 0;
-		status = OCIStmtFetch2(gstate.stmt.get(), ctx->errhp, STANDARD_VECTOR_SIZE, OCI_FETCH_NEXT, 0, OCI_DEFAULT);
-		if (status != OCI_SUCCESS && status != OCI_SUCCESS_WITH_INFO && status != OCI_NO_DATA) {
-			CheckOCIError(status, ctx->errhp, "Failed to fetch OCI data");
+		if (!have_batch) {
+			if (gstate.pending_fetch.valid()) {
+				// Read-ahead batch: it landed in the ahead buffers, which become the current ones.
+				fetched = gstate.pending_fetch.get();
+				std::swap(gstate.buffers, gstate.ahead_buffers);
+				std::swap(gstate.indicators, gstate.ahead_indicators);
+				std::swap(gstate.return_lens, gstate.ahead_return_lens);
+			} else {
+				fetched = FetchBatch(context, gstate, *ctx);
+			}
 		}
-		OCIAttrGet(gstate.stmt.get(), OCI_HTYPE_STMT, &rows_fetched, 0, OCI_ATTR_ROWS_FETCHED, ctx->errhp);
+		status = fetched.first;
+		rows_fetched = fetched.second;
 		if (getenv("ORACLE_DEBUG")) {
 			fprintf(stderr, "[oracle] fetch status=%d rows=%u\n", status, (unsigned)rows_fetched);
 		}
+	} catch (...) {
+		// Interrupted or failed: the session goes back to the pool now, not when the plan is torn down.
+		gstate.finished = true;
+		gstate.Release();
+		throw;
+	}
 
-		if (status == OCI_NO_DATA && rows_fetched == 0) {
-			gstate.finished = true;
-			output.SetCardinality(0);
-			return;
-		}
+	if (!gstate.tuned) {
+		SampleFetch(bind_data, gstate, rows_fetched, status == OCI_NO_DATA);
+	}
+	if (bind_data.settings.read_ahead && status != OCI_NO_DATA) {
+		// Overlap the next round trip with converting this batch and the downstream pipeline.
+		StartReadAhead(context, bind_data, gstate, ctx);
+	}
 
-		for (row_count = 0; row_count < rows_fetched; row_count++) {
-			for (idx_t col_idx = 0; col_idx < output.ColumnCount(); col_idx++) {
-				idx_t buffer_idx = col_idx;
-				if (col_idx < gstate.column_mapping.size()) {
-					buffer_idx = gstate.column_mapping[col_idx];
-				} else if (gstate.column_mapping.empty()) {
-					// No mapping (identity), but be safe
-					buffer_idx = col_idx;
-				}
+	if (status == OCI_NO_DATA && rows_fetched == 0) {
+		gstate.finished = true;
+		gstate.Release();
+		output.SetCardinality(0);
+		return;
+	}
 
-				if (buffer_idx >= gstate.indicators.size()) {
-					continue;
-				}
+	for (row_count = 0; row_count < rows_fetched; row_count++) {
+		for (idx_t col_idx = 0; col_idx < output.ColumnCount(); col_idx++) {
+			idx_t buffer_idx = col_idx;
+			if (col_idx < gstate.column_mapping.size()) {
+				buffer_idx = gstate.column_mapping[col_idx];
+			} else if (gstate.column_mapping.empty()) {
+				// No mapping (identity), but be safe
+				buffer_idx = col_idx;
+			}
 
-				if (gstate.indicators[buffer_idx][row_count] == -1) {
-					FlatVector::SetNull(output.data[col_idx], row_count, true);
-					continue;
-				}
+			if (buffer_idx >= gstate.indicators.size()) {
+				continue;
+			}
 
-				ub4 element_size = gstate.buffers[buffer_idx].size() / STANDARD_VECTOR_SIZE;
-				char *ptr = (char *)gstate.buffers[buffer_idx].data() + (row_count * element_size);
-				ub2 actual_len = gstate.return_lens[buffer_idx][row_count];
-
-				switch (output.GetTypes()[col_idx].id()) {
-				case LogicalTypeId::VARCHAR:
-				case LogicalTypeId::BLOB: {
-					string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
-					FlatVector::GetData<string_t>(output.data[col_idx])[row_count] =
-					    StringVector::AddString(output.data[col_idx], val);
-					break;
-				}
-				case LogicalTypeId::BIGINT: {
-					// Fetch as string, parse to int64
-					string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
-					string s = val.GetString();
-					try {
-						FlatVector::GetData<int64_t>(output.data[col_idx])[row_count] = std::stoll(s);
-					} catch (...) {
-						FlatVector::SetNull(output.data[col_idx], row_count, true);
-					}
-					break;
-				}
-				case LogicalTypeId::DOUBLE: {
-					// Fetch as string, parse to double
-					string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
-					string s = val.GetString();
-					try {
-						FlatVector::GetData<double>(output.data[col_idx])[row_count] = std::stod(s);
-					} catch (...) {
-						FlatVector::SetNull(output.data[col_idx], row_count, true);
-					}
-					break;
-				}
-				case LogicalTypeId::DECIMAL: {
-					// Oracle NUMBER -> DuckDB DECIMAL
-					// Fetch as string, convert using DuckDB's decimal conversion
-					string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
-					string s = val.GetString();
-					try {
-						// Use Value::DECIMAL to parse and convert
-						auto decimal_val = Value(s).DefaultCastAs(output.GetTypes()[col_idx]);
-						output.data[col_idx].SetValue(row_count, decimal_val);
-					} catch (...) {
-						FlatVector::SetNull(output.data[col_idx], row_count, true);
-					}
-					break;
+			if (gstate.indicators[buffer_idx][row_count] == -1) {
+				FlatVector::SetNull(output.data[col_idx], row_count, true);
+				continue;
+			}
+
+			ub4 element_size = gstate.buffers[buffer_idx].size() / STANDARD_VECTOR_SIZE;
+			char *ptr = (char *)gstate.buffers[buffer_idx].data() + (row_count * element_size);
+			ub2 actual_len = gstate.return_lens[buffer_idx][row_count];
+
+			switch (output.GetTypes()[col_idx].id()) {
+			case LogicalTypeId::VARCHAR:
+			case LogicalTypeId::BLOB: {
+				string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
+				FlatVector::GetData<string_t>(output.data[col_idx])[row_count] =
+				    StringVector::AddString(output.data[col_idx], val);
+				break;
+			}
+			case LogicalTypeId::BIGINT: {
+				// Fetch as string, parse to int64
+				string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
+				string s = val.GetString();
+				try {
+					FlatVector::GetData<int64_t>(output.data[col_idx])[row_count] = std::stoll(s);
+				} catch (...) {
+					FlatVector::SetNull(output.data[col_idx], row_count, true);
 				}
-				case LogicalTypeId::TIMESTAMP:
-					FlatVector::GetData<timestamp_t>(output.data[col_idx])[row_count] =
-					    ParseOciTimestamp(ptr, gstate.return_lens[buffer_idx][row_count]);
-					break;
-				case LogicalTypeId::LIST: {
-					// Parse VECTOR JSON array to LIST<FLOAT>
-					// VECTOR_SERIALIZE returns "[1.0, 2.0, 3.0]" format
-					string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
-					string json_str = val.GetString();
-					auto list_val = ParseVectorJsonToList(json_str);
-					// Use SetValue for proper LIST handling in table function output
-					output.data[col_idx].SetValue(row_count, list_val);
-					break;
+				break;
+			}
+			case LogicalTypeId::DOUBLE: {
+				// Fetch as string, parse to double
+				string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
+				string s = val.GetString();
+				try {
+					FlatVector::GetData<double>(output.data[col_idx])[row_count] = std::stod(s);
+				} catch (...) {
+					FlatVector::SetNull(output.data[col_idx], row_count, true);
 				}
-				case LogicalTypeId::USER: {
-					// Handle GEOMETRY type (mapped from SDO_GEOMETRY -> WKT -> GEOMETRY)
-					// We fetch WKT as string, then cast to target USER type (GEOMETRY)
-					string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
-					string s = val.GetString();
-					try {
-						// CastAs requires ClientContext to look up the cast function (VARCHAR -> GEOMETRY)
-						auto geom_val = Value(s).CastAs(context, output.GetTypes()[col_idx]);
-						output.data[col_idx].SetValue(row_count, geom_val);
-					} catch (...) {
-						// If cast fails (e.g. spatial extension not loaded), set to NULL
-						FlatVector::SetNull(output.data[col_idx], row_count, true);
-					}
-					break;
+				break;
+			}
+			case LogicalTypeId::DECIMAL: {
+				// Oracle NUMBER -> DuckDB DECIMAL
+				// Fetch as string, convert using DuckDB's decimal conversion
+				string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
+				string s = val.GetString();
+				try {
+					// Use Value::DECIMAL to parse and convert
+					auto decimal_val = Value(s).DefaultCastAs(output.GetTypes()[col_idx]);
+					output.data[col_idx].SetValue(row_count, decimal_val);
+				} catch (...) {
+					FlatVector::SetNull(output.data[col_idx], row_count, true);
 				}
-				default:
-					break;
+				break;
+			}
+			case LogicalTypeId::TIMESTAMP:
+				FlatVector::GetData<timestamp_t>(output.data[col_idx])[row_count] =
+				    ParseOciTimestamp(ptr, gstate.return_lens[buffer_idx][row_count]);
+				break;
+			case LogicalTypeId::LIST: {
+				// Parse VECTOR JSON array to LIST<FLOAT>
+				// VECTOR_SERIALIZE returns "[1.0, 2.0, 3.0]" format
+				string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
+				string json_str = val.GetString();
+				auto list_val = ParseVectorJsonToList(json_str);
+				// Use SetValue for proper LIST handling in table function output
+				output.data[col_idx].SetValue(row_count, list_val);
+				break;
+			}
+			case LogicalTypeId::USER: {
+				// Handle GEOMETRY type (mapped from SDO_GEOMETRY -> WKT -> GEOMETRY)
+				// We fetch WKT as string, then cast to target USER type (GEOMETRY)
+				string_t val(ptr, gstate.return_lens[buffer_idx][row_count]);
+				string s = val.GetString();
+				try {
+					// CastAs requires ClientContext to look up the cast function (VARCHAR -> GEOMETRY)
+					auto geom_val = Value(s).CastAs(context, output.GetTypes()[col_idx]);
+					output.data[col_idx].SetValue(row_count, geom_val);
+				} catch (...) {
+					// If cast fails (e.g. spatial extension not loaded), set to NULL
+					FlatVector::SetNull(output.data[col_idx], row_count, true);
 				}
+				break;
+			}
+			default:
+				break;
 			}
 		}
-		output.SetCardinality(row_count);
-		if (status == OCI_NO_DATA) {
-			gstate.finished = true;
-		}
-	} catch (...) {
-		throw;
+	}
+	output.SetCardinality(row_count);
+	if (status == OCI_NO_DATA) {
+		// The last batch is already copied into output; close the cursor now.
+		gstate.finished = true;
+		gstate.Release();
 	}
 }
 
@@ -897,7 +1496,9 @@ static bool ConstantToSQL(Expression &expr, string &out_sql) {
 	return true;
 }
 
-static bool TryExtractComparison(Expression &expr, const vector<string> &names, string &out_clause) {
+//! equality_column receives the column name of an `=` comparison and stays untouched for the other operators.
+static bool TryExtractComparison(Expression &expr, const vector<string> &names, string &out_clause,
+                                 string *equality_column = nullptr) {
 	if (expr.type != ExpressionType::COMPARE_EQUAL && expr.type != ExpressionType::COMPARE_LESSTHAN &&
 	    expr.type != ExpressionType::COMPARE_GREATERTHAN && expr.type != ExpressionType::COMPARE_LESSTHANOREQUALTO &&
 	    expr.type != ExpressionType::COMPARE_GREATERTHANOREQUALTO) {
@@ -997,6 +1598,9 @@ static bool TryExtractComparison(Expression &expr, const vector<string> &names,
 	}
 
 	out_clause = ColumnRefSQL(names[col_idx]) + " " + op + " " + const_sql;
+	if (equality_column && op_type == ExpressionType::COMPARE_EQUAL) {
+		*equality_column = names[col_idx];
+	}
 	return true;
 }
 
@@ -1045,10 +1649,15 @@ void OraclePushdownComplexFilter(ClientContext &, LogicalGet &get, FunctionData
 
 	vector<unique_ptr<Expression>> remaining;
 	vector<string> clauses;
+	vector<string> equality_columns;
 	for (auto &expr : expressions) {
 		string clause;
-		if (TryExtractComparison(*expr, bind.column_names, clause) ||
+		string equality_column;
+		if (TryExtractComparison(*expr, bind.column_names, clause, &equality_column) ||
 		    TryExtractIsNull(*expr, bind.column_names, clause)) {
+			if (!equality_column.empty()) {
+				equality_columns.push_back(std::move(equality_column));
+			}
 			if (bind.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
 				fprintf(stderr, "[oracle] pushdown: extracted clause: %s\n", clause.c_str());
 			}
@@ -1114,12 +1723,129 @@ void OraclePushdownComplexFilter(ClientContext &, LogicalGet &get, FunctionData
 	bind.oci_sizes = projected_oci_sizes;
 
 	bind.query = "SELECT " + select_sql + " FROM (" + bind.base_query + ")" + where_sql;
+	bind.pushed_filter_count = clauses.size();
+	bind.pushed_equality_columns = std::move(equality_columns);
 	if (bind.settings.debug_show_queries) {
 		fprintf(stderr, "[oracle] pushdown query: %s\n", bind.query.c_str());
 	}
 	expressions = std::move(remaining);
 }
 
+namespace {
+//! Oracle optimizer row estimates keyed by connection string and SQL text; an invalid entry records a failed EXPLAIN.
+struct OraclePlanCardinalityCache {
+	static constexpr idx_t MAX_ENTRIES = 4096;
+	std::mutex lock;
+	unordered_map<string, optional_idx> entries;
+};
+
+static OraclePlanCardinalityCache &PlanCardinalityCache() {
+	static OraclePlanCardinalityCache cache;
+	return cache;
+}
+} // namespace
+
+static optional_idx ExplainCardinality(const OracleBindData &bind) {
+	auto key = bind.connection_string + "\n" + bind.query;
+	auto &cache = PlanCardinalityCache();
+	{
+		lock_guard<std::mutex> guard(cache.lock);
+		auto entry = cache.entries.find(key);
+		if (entry != cache.entries.end()) {
+			return entry->second;
+		}
+	}
+
+	optional_idx cardinality;
+	OracleConnection conn;
+	try {
+		// EXPLAIN PLAN writes to the session-private PLAN_TABLE; roll back so nothing is left behind.
+		conn.Connect(bind.connection_string, bind.settings);
+		conn.Execute("EXPLAIN PLAN SET STATEMENT_ID = 'DUCKDB_CARDINALITY' FOR " + bind.query);
+		auto result = conn.Query("SELECT TO_CHAR(cardinality) FROM plan_table "
+		                         "WHERE statement_id = 'DUCKDB_CARDINALITY' AND id = 0");
+		conn.Rollback();
+		if (result.RowCount() > 0 && !result.IsNull(0, 0)) {
+			cardinality = static_cast<idx_t>(result.GetInt64(0, 0));
+		}
+	} catch (std::exception &ex) {
+		// The pooled session must not go back with the PLAN_TABLE rows of a half-done EXPLAIN open.
+		if (conn.IsConnected()) {
+			try {
+				conn.Rollback();
+			} catch (std::exception &) {
+			}
+		}
+		if (bind.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+			fprintf(stderr, "[oracle] EXPLAIN PLAN failed: %s\n", ex.what());
+		}
+	}
+	if (bind.settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] EXPLAIN PLAN cardinality=%s for: %s\n",
+		        cardinality.IsValid() ? std::to_string(cardinality.GetIndex()).c_str() : "unknown", bind.query.c_str());
+	}
+
+	lock_guard<std::mutex> guard(cache.lock);
+	if (cache.entries.size() >= OraclePlanCardinalityCache::MAX_ENTRIES) {
+		cache.entries.clear();
+	}
+	cache.entries[key] = cardinality;
+	return cardinality;
+}
+
+static void ClearPlanCardinalityCache() {
+	auto &cache = PlanCardinalityCache();
+	lock_guard<std::mutex> guard(cache.lock);
+	cache.entries.clear();
+}
+
+unique_ptr<NodeStatistics> OracleScanCardinality(ClientContext &, const FunctionData *bind_data_p) {
+	auto &bind = bind_data_p->Cast<OracleBindData>();
+	bool has_table_rows = bind.table_stats && bind.table_stats->has_row_count;
+	if (has_table_rows && bind.pushed_filter_count == 0) {
+		auto num_rows = bind.table_stats->num_rows;
+		return make_uniq<NodeStatistics>(num_rows, num_rows);
+	}
+	// Pushed filters and ad-hoc SQL are opaque to DuckDB's estimator; let Oracle's optimizer estimate them. Point
+	// lookups skip it: EXPLAIN is cached per SQL text, so every new key would cost more round trips than the lookup.
+	if (bind.settings.explain_cardinality && !IsPointLookup(bind)) {
+		auto estimate = ExplainCardinality(bind);
+		if (estimate.IsValid()) {
+			if (has_table_rows) {
+				return make_uniq<NodeStatistics>(estimate.GetIndex(), bind.table_stats->num_rows);
+			}
+			return make_uniq<NodeStatistics>(estimate.GetIndex());
+		}
+	}
+	if (!has_table_rows) {
+		return nullptr;
+	}
+	auto num_rows = bind.table_stats->num_rows;
+	// Without EXPLAIN, apply DuckDB's default selectivity per pushed clause.
+	double estimate = static_cast<double>(num_rows);
+	for (idx_t i = 0; i < bind.pushed_filter_count; i++) {
+		estimate *= 0.2;
+	}
+	return make_uniq<NodeStatistics>(MaxValue<idx_t>(1, static_cast<idx_t>(estimate)), num_rows);
+}
+
+unique_ptr<BaseStatistics> OracleScanStatistics(ClientContext &, const FunctionData *bind_data_p,
+                                                column_t column_index) {
+	auto &bind = bind_data_p->Cast<OracleBindData>();
+	if (!bind.table_stats || column_index >= bind.original_names.size()) {
+		return nullptr;
+	}
+	auto entry = bind.table_stats->columns.find(bind.original_names[column_index]);
+	if (entry == bind.table_stats->columns.end()) {
+		return nullptr;
+	}
+	// Only the distinct count is exposed: dictionary min/max and null counts can be stale, and DuckDB uses them
+	// to prune filters, which would silently drop rows inserted since the last ANALYZE.
+	auto stats = BaseStatistics::CreateUnknown(bind.original_types[column_index]);
+	stats.SetDistinctCount(entry->second.num_distinct);
+	return stats.ToUnique();
+}
+
 static void OracleAttachWallet(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto wallet_path = args.data[0].GetValue(0).ToString();
 	if (!PathIsDirectory(wallet_path)) {
@@ -1131,10 +1857,60 @@ static void OracleAttachWallet(DataChunk &args, ExpressionState &state, Vector &
 
 static void OracleClearCache(DataChunk &, ExpressionState &, Vector &result) {
 	OracleCatalogState::ClearAllCaches();
+	ClearPlanCardinalityCache();
+	OracleClearDescribeCache();
+	ClearFetchProfileCache();
 	OracleConnectionManager::Instance().Clear();
 	result.SetValue(0, Value("oracle caches cleared"));
 }
 
+struct OraclePoolStatsState : public GlobalTableFunctionState {
+	std::vector<OracleConnectionPoolStats> pools;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> OraclePoolStatsBind(ClientContext &, TableFunctionBindInput &,
+                                                    vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"pool", "pool_mode", "total", "idle", "in_use", "bulk_in_use", "max_sessions", "acquires", "waits",
+	         "wait_lt_1ms", "wait_lt_10ms", "wait_lt_100ms", "wait_lt_1s", "wait_ge_1s", "total_wait_ms", "timeouts",
+	         "creations", "evictions", "failed_logons"};
+	return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR};
+	for (idx_t i = 2; i < names.size(); i++) {
+		return_types.push_back(names[i] == "total_wait_ms" ? LogicalType::DOUBLE : LogicalType::UBIGINT);
+	}
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> OraclePoolStatsInit(ClientContext &, TableFunctionInitInput &) {
+	auto result = make_uniq<OraclePoolStatsState>();
+	result->pools = OracleConnectionManager::Instance().Stats();
+	return std::move(result);
+}
+
+static void OraclePoolStatsFunction(ClientContext &, TableFunctionInput &data, DataChunk &output) {
+	auto &state = data.global_state->Cast<OraclePoolStatsState>();
+	idx_t count = 0;
+	while (state.offset < state.pools.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &stats = state.pools[state.offset++];
+		idx_t col = 0;
+		output.SetValue(col++, count, Value(stats.pool));
+		output.SetValue(col++, count, Value(stats.pool_mode));
+		for (auto val :
+		     {stats.total, stats.idle, stats.in_use, stats.bulk_in_use, stats.limit, stats.acquires, stats.waits}) {
+			output.SetValue(col++, count, Value::UBIGINT(val));
+		}
+		for (auto val : stats.wait_histogram) {
+			output.SetValue(col++, count, Value::UBIGINT(val));
+		}
+		output.SetValue(col++, count, Value::DOUBLE(static_cast<double>(stats.total_wait_us) / 1000.0));
+		for (auto val : {stats.timeouts, stats.creations, stats.evictions, stats.failed_logons}) {
+			output.SetValue(col++, count, Value::UBIGINT(val));
+		}
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
 static void LoadInternal(ExtensionLoader &loader) {
 	// Register Oracle secret type
 	SecretType secret_type;
@@ -1152,6 +1928,8 @@ static void LoadInternal(ExtensionLoader &loader) {
 	secret_function.named_parameters["user"] = LogicalType::VARCHAR;
 	secret_function.named_parameters["password"] = LogicalType::VARCHAR;
 	secret_function.named_parameters["wallet_path"] = LogicalType::VARCHAR;
+	secret_function.named_parameters["pool_mode"] = LogicalType::VARCHAR;
+	secret_function.named_parameters["connection_class"] = LogicalType::VARCHAR;
 	loader.RegisterFunction(secret_function);
 
 	auto oracle_scan_func =
@@ -1163,14 +1941,26 @@ static void LoadInternal(ExtensionLoader &loader) {
 	oracle_scan_func.filter_pushdown = false;
 	oracle_scan_func.pushdown_complex_filter = OraclePushdownComplexFilter;
 	oracle_scan_func.projection_pushdown = true;
+	oracle_scan_func.cardinality = OracleScanCardinality;
 	loader.RegisterFunction(oracle_scan_func);
 
+	auto oracle_scan_changes_func = TableFunction(
+	    "oracle_scan_changes", {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::BIGINT},
+	    OracleQueryFunction, OracleScanChangesBind, OracleInitGlobal, nullptr);
+	oracle_scan_changes_func.named_parameters["flashback"] = LogicalType::BOOLEAN;
+	oracle_scan_changes_func.filter_pushdown = false;
+	oracle_scan_changes_func.pushdown_complex_filter = OraclePushdownComplexFilter;
+	oracle_scan_changes_func.projection_pushdown = true;
+	oracle_scan_changes_func.cardinality = OracleScanCardinality;
+	loader.RegisterFunction(oracle_scan_changes_func);
+
 	auto oracle_query_func = TableFunction("oracle_query", {LogicalType::VARCHAR, LogicalType::VARCHAR},
 	                                       OracleQueryFunction, OracleQueryBind, OracleInitGlobal, nullptr);
 	// We don't implement table_filters, so set filter_pushdown = false
 	oracle_query_func.filter_pushdown = false;
 	oracle_query_func.pushdown_complex_filter = OraclePushdownComplexFilter;
 	oracle_query_func.projection_pushdown = true;
+	oracle_query_func.cardinality = OracleScanCardinality;
 	loader.RegisterFunction(oracle_query_func);
 
 	auto attach_wallet_func =
@@ -1180,6 +1970,10 @@ static void LoadInternal(ExtensionLoader &loader) {
 	auto clear_cache_func = ScalarFunction("oracle_clear_cache", {}, LogicalType::VARCHAR, OracleClearCache);
 	loader.RegisterFunction(clear_cache_func);
 
+	auto pool_stats_func =
+	    TableFunction("oracle_pool_stats", {}, OraclePoolStatsFunction, OraclePoolStatsBind, OraclePoolStatsInit);
+	loader.RegisterFunction(pool_stats_func);
+
 	auto oracle_execute_func = ScalarFunction("oracle_execute", {LogicalType::VARCHAR, LogicalType::VARCHAR},
 	                                          LogicalType::VARCHAR, OracleExecuteFunction);
 	loader.RegisterFunction(oracle_execute_func);
@@ -1196,6 +1990,7 @@ static void LoadInternal(ExtensionLoader &loader) {
 	copy_func.copy_to_initialize_local = OracleWriteInitLocal;
 	copy_func.copy_to_sink = OracleWriteSink;
 	copy_func.copy_to_finalize = OracleWriteFinalize;
+	copy_func.execution_mode = OracleWriteExecutionMode;
 	loader.RegisterFunction(copy_func);
 }
 
@@ -1209,12 +2004,50 @@ void OracleExtension::Load(ExtensionLoader &loader) {
 	                          Value::UBIGINT(1024));
 	config.AddExtensionOption("oracle_prefetch_memory", "OCI prefetch memory (bytes, 0=auto)", LogicalType::UBIGINT,
 	                          Value::UBIGINT(0));
+	config.AddExtensionOption("oracle_adaptive_prefetch",
+	                          "Tune OCI prefetch and fetch size per table from measured row width and latency",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("oracle_fetch_target_bytes", "Bytes per round trip aimed at by oracle_adaptive_prefetch",
+	                          LogicalType::UBIGINT, Value::UBIGINT(1048576));
+	config.AddExtensionOption("oracle_read_ahead", "Fetch the next batch of a scan on an I/O thread while converting",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("oracle_io_threads",
+	                          "I/O threads for read-ahead fetches, and as many for speculative executes",
+	                          LogicalType::UBIGINT, Value::UBIGINT(4));
+	config.AddExtensionOption("oracle_speculative_execute",
+	                          "Open scan cursors and fetch their first batch on an I/O thread during query setup",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
+	config.AddExtensionOption("oracle_point_lookup",
+	                          "Execute catalog-table key lookups and fetch their first batch in one round trip",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
 	config.AddExtensionOption("oracle_array_size", "Rows fetched per OCI iteration (used for tuning)",
 	                          LogicalType::UBIGINT, Value::UBIGINT(256));
 	config.AddExtensionOption("oracle_connection_cache", "Reuse Oracle connections when possible", LogicalType::BOOLEAN,
 	                          Value::BOOLEAN(true));
 	config.AddExtensionOption("oracle_connection_limit", "Maximum cached Oracle connections", LogicalType::UBIGINT,
 	                          Value::UBIGINT(8));
+	config.AddExtensionOption("oracle_min_connections", "Oracle sessions opened in parallel on ATTACH and kept pooled",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("oracle_connection_max_idle_time",
+	                          "Seconds a pooled Oracle session may stay idle before it is closed (0=never)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(600));
+	config.AddExtensionOption("oracle_connection_max_lifetime",
+	                          "Seconds after which a pooled Oracle session is closed (0=never)", LogicalType::UBIGINT,
+	                          Value::UBIGINT(0));
+	config.AddExtensionOption("oracle_connection_validation_interval",
+	                          "Ping pooled Oracle sessions idle for at least this many seconds before reuse",
+	                          LogicalType::UBIGINT, Value::UBIGINT(30));
+	config.AddExtensionOption("oracle_reserved_connections",
+	                          "Pool slots kept for interactive work (catalog lookups, binds, DML), never used by scans",
+	                          LogicalType::UBIGINT, Value::UBIGINT(1));
+	config.AddExtensionOption("oracle_bulk_connection_limit",
+	                          "Maximum pooled Oracle sessions held by table scans (0=pool limit minus reserved)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("oracle_scan_priority", "Pool priority class of table scans: 'bulk' or 'interactive'",
+	                          LogicalType::VARCHAR, Value("bulk"));
+	config.AddExtensionOption("oracle_session_init",
+	                          "ALTER SESSION statements and PL/SQL calls (';'-separated) run once per Oracle session",
+	                          LogicalType::VARCHAR, Value(""));
 	config.AddExtensionOption("oracle_debug_show_queries", "Log generated Oracle SQL for debugging",
 	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
 
@@ -1232,6 +2065,16 @@ void OracleExtension::Load(ExtensionLoader &loader) {
 	config.AddExtensionOption("oracle_enable_spatial_types",
 	                          "Map SDO_GEOMETRY to GEOMETRY type (requires spatial extension)", LogicalType::BOOLEAN,
 	                          Value::BOOLEAN(true));
+	config.AddExtensionOption("oracle_enable_statistics",
+	                          "Use Oracle dictionary statistics for cardinality and distinct-count estimates",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(true));
+	config.AddExtensionOption("oracle_describe_cache_size",
+	                          "Number of oracle_query describe results of attached databases cached by SQL text "
+	                          "(0=disabled)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("oracle_explain_cardinality",
+	                          "Estimate oracle_query/oracle_scan cardinality with EXPLAIN PLAN (cached per SQL text)",
+	                          LogicalType::BOOLEAN, Value::BOOLEAN(false));
 
 	config.storage_extensions["oracle"] = CreateOracleStorageExtension();
 }
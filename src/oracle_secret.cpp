@@ -65,6 +65,16 @@ OracleSecretParameters ParseOracleSecret(const CreateSecretInput &input) {
 		params.wallet_path = wallet_lookup->second.ToString();
 	}
 
+	// Parse session backend (optional)
+	auto pool_mode_lookup = input.options.find("pool_mode");
+	if (pool_mode_lookup != input.options.end()) {
+		params.pool_mode = StringUtil::Lower(pool_mode_lookup->second.ToString());
+	}
+	auto connection_class_lookup = input.options.find("connection_class");
+	if (connection_class_lookup != input.options.end()) {
+		params.connection_class = connection_class_lookup->second.ToString();
+	}
+
 	return params;
 }
 
@@ -88,6 +98,12 @@ void ValidateOracleSecret(const OracleSecretParameters &params) {
 		                            "SERVICE 'XEPDB1', USER 'scott', PASSWORD 'tiger')");
 	}
 
+	if (!params.pool_mode.empty() && params.pool_mode != "dedicated" && params.pool_mode != "session_pool" &&
+	    params.pool_mode != "drcp") {
+		throw InvalidInputException("Oracle secret: POOL_MODE must be 'dedicated', 'session_pool' or 'drcp', got '%s'",
+		                            params.pool_mode);
+	}
+
 	// Validate port range
 	if (params.port == 0 || params.port > 65535) {
 		throw InvalidInputException("Oracle secret: PORT must be between 1 and 65535, got %llu", params.port);
@@ -140,6 +156,15 @@ string BuildConnectionStringFromSecret(const KeyValueSecret &secret) {
 	return connection_string;
 }
 
+void ApplyOracleSecretOptions(const KeyValueSecret &secret, case_insensitive_map_t<Value> &options) {
+	for (auto key : {"pool_mode", "connection_class"}) {
+		Value val;
+		if (options.find(key) == options.end() && secret.TryGetValue(key, val)) {
+			options[key] = val;
+		}
+	}
+}
+
 unique_ptr<BaseSecret> CreateOracleSecretFromConfig(ClientContext &context, CreateSecretInput &input) {
 	// Parse and validate parameters
 	auto params = ParseOracleSecret(input);
@@ -158,6 +183,12 @@ unique_ptr<BaseSecret> CreateOracleSecretFromConfig(ClientContext &context, Crea
 	if (!params.wallet_path.empty()) {
 		secret->secret_map["wallet_path"] = Value(params.wallet_path);
 	}
+	if (!params.pool_mode.empty()) {
+		secret->secret_map["pool_mode"] = Value(params.pool_mode);
+	}
+	if (!params.connection_class.empty()) {
+		secret->secret_map["connection_class"] = Value(params.connection_class);
+	}
 
 	// Mark password as sensitive (will be redacted in output)
 	secret->redact_keys.insert("password");
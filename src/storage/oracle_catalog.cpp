@@ -1,11 +1,23 @@
 #include "oracle_catalog_state.hpp"
+#include "oracle_mirror.hpp"
+#include "oracle_table_function.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/limits.hpp"
+#include <cstdio>
+#include <fstream>
+#include <functional>
 #include <mutex>
 #include <memory>
 
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
 namespace duckdb {
 namespace {
 static std::mutex &RegistryLock() {
@@ -22,26 +34,188 @@ static unordered_map<string, weak_ptr<OracleCatalogState>> &AliasRegistry() {
 	static unordered_map<string, weak_ptr<OracleCatalogState>> registry;
 	return registry;
 }
+
+static idx_t ParseDictionaryIndex(const string &s) {
+	if (s.empty()) {
+		return 0;
+	}
+	try {
+		return static_cast<idx_t>(std::stoll(s));
+	} catch (...) {
+		return 0;
+	}
+}
+
+static OracleColumnInfo ParseColumnInfo(const vector<string> &row, idx_t offset) {
+	OracleColumnInfo column;
+	column.name = row[offset];
+	column.data_type = row[offset + 1];
+	column.data_length = ParseDictionaryIndex(row[offset + 2]);
+	column.precision = ParseDictionaryIndex(row[offset + 3]);
+	column.scale = ParseDictionaryIndex(row[offset + 4]);
+	column.nullable = row[offset + 5] == "Y";
+	return column;
+}
+
+static OracleColumnInfo ParseColumnInfo(const OracleResult &result, idx_t row, idx_t offset) {
+	vector<string> fields;
+	for (idx_t i = 0; i < 6; i++) {
+		fields.push_back(result.GetString(row, offset + i));
+	}
+	return ParseColumnInfo(fields, 0);
+}
+
+static string ColumnCacheKey(const string &schema, const string &table) {
+	return StringUtil::Upper(schema) + "." + table;
+}
+
+static constexpr const char *METADATA_CACHE_MAGIC = "DUCKDB_ORACLE_METADATA";
+static constexpr const char *METADATA_CACHE_VERSION = "1";
+//! Object types whose LAST_DDL_TIME invalidates cached metadata.
+static constexpr const char *METADATA_CACHE_OBJECT_TYPES = "'TABLE','VIEW','MATERIALIZED VIEW','SYNONYM'";
+//! Newest LAST_DDL_TIME of a group. LAST_DDL_TIME has one-second granularity, so a time within the last second may
+//! still be followed by DDL that leaves it unchanged; such times are marked with a trailing '?' and never match.
+static constexpr const char *METADATA_DDL_TIME = "TO_CHAR(MAX(last_ddl_time), 'YYYYMMDDHH24MISS') || "
+                                                 "CASE WHEN MAX(last_ddl_time) >= SYSDATE - 1 / 86400 THEN '?' END";
+
+static bool DdlTimeMatches(const string &baseline, const string &current) {
+	return baseline == current && (baseline.empty() || baseline.back() != '?');
+}
+
+static string EscapeCacheField(const string &value) {
+	string result;
+	for (auto c : value) {
+		if (c == '\\') {
+			result += "\\\\";
+		} else if (c == '\t') {
+			result += "\\t";
+		} else if (c == '\n') {
+			result += "\\n";
+		} else {
+			result += c;
+		}
+	}
+	return result;
+}
+
+static vector<string> SplitCacheLine(const string &line) {
+	vector<string> fields(1);
+	for (idx_t i = 0; i < line.size(); i++) {
+		auto c = line[i];
+		if (c == '\t') {
+			fields.emplace_back();
+		} else if (c == '\\' && i + 1 < line.size()) {
+			auto next = line[++i];
+			fields.back() += next == 't' ? '\t' : next == 'n' ? '\n' : next;
+		} else {
+			fields.back() += c;
+		}
+	}
+	return fields;
+}
+
+static string CacheLine(const string &tag, const vector<string> &fields) {
+	string line = tag;
+	for (auto &field : fields) {
+		line += '\t';
+		line += EscapeCacheField(field);
+	}
+	return line + "\n";
+}
+
+//! Identifies the database/user a cache file belongs to without storing credentials.
+static string ConnectionFingerprint(const string &connection_string) {
+	return std::to_string(std::hash<string> {}(connection_string));
+}
 } // namespace
 
-void OracleCatalogState::Connect() {
+OracleCatalogState::~OracleCatalogState() {
+	if (mirrors) {
+		mirrors->Stop();
+	}
+	try {
+		SaveMetadataCache();
+	} catch (std::exception &ex) {
+		if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+			fprintf(stderr, "[oracle] failed to save metadata cache: %s\n", ex.what());
+		}
+	}
+}
+
+void OracleCatalogState::StartMirrors(DatabaseInstance &db) {
 	lock_guard<std::mutex> guard(lock);
-	EnsureConnectionInternal();
+	if (mirrors || settings.mirror_tables.empty()) {
+		return;
+	}
+	mirrors = make_shared_ptr<OracleMirrorManager>(connection_string, settings);
+	mirrors->Start(db);
+}
+
+void OracleCatalogState::Connect() {
+	// Open a session up front so connection errors surface at ATTACH; it stays pooled for later lookups.
+	idx_t epoch;
+	auto session = BorrowSession(epoch);
+	try {
+		if (!session) {
+			session = make_uniq<OracleConnection>();
+		}
+		session->Connect(connection_string, settings);
+	} catch (...) {
+		ReleaseSession(nullptr, epoch);
+		throw;
+	}
+	ReleaseSession(std::move(session), epoch);
 }
 
 OracleResult OracleCatalogState::Query(const std::string &query) {
-	lock_guard<std::mutex> guard(lock);
-	return EnsureConnectionInternal().Query(query);
+	return QueryMetadata(query);
 }
 
-OracleConnection &OracleCatalogState::EnsureConnectionInternal() {
-	if (!settings.connection_cache) {
-		connection = make_uniq<OracleConnection>();
+OracleResult OracleCatalogState::QueryMetadata(const string &query) {
+	idx_t epoch;
+	auto session = BorrowSession(epoch);
+	OracleResult result;
+	try {
+		if (!session) {
+			session = make_uniq<OracleConnection>();
+		}
+		session->Connect(connection_string, settings);
+		result = session->Query(query);
+	} catch (...) {
+		// The session may be broken; drop it and let the next borrower connect afresh.
+		ReleaseSession(nullptr, epoch);
+		throw;
 	}
-	if (!connection->IsConnected()) {
-		connection->Connect(connection_string);
+	ReleaseSession(std::move(session), epoch);
+	return result;
+}
+
+unique_ptr<OracleConnection> OracleCatalogState::BorrowSession(idx_t &epoch) {
+	std::unique_lock<std::mutex> guard(session_lock);
+	session_cv.wait(guard, [&]() { return sessions_in_use < MaxValue<idx_t>(1, settings.metadata_connections); });
+	sessions_in_use++;
+	epoch = session_epoch;
+	if (idle_sessions.empty()) {
+		return nullptr;
+	}
+	auto session = std::move(idle_sessions.back());
+	idle_sessions.pop_back();
+	return session;
+}
+
+void OracleCatalogState::ReleaseSession(unique_ptr<OracleConnection> session, idx_t epoch) {
+	{
+		lock_guard<std::mutex> guard(session_lock);
+		sessions_in_use--;
+		if (session && settings.connection_cache && epoch == session_epoch) {
+			idle_sessions.push_back(std::move(session));
+		}
 	}
-	return *connection;
+	session_cv.notify_one();
+}
+
+OracleCatalogState::CacheShard &OracleCatalogState::ShardFor(const string &key) {
+	return shards[std::hash<string> {}(key) % CACHE_SHARD_COUNT];
 }
 
 void OracleCatalogState::ApplyOptions(const unordered_map<string, Value> &options) {
@@ -56,6 +230,20 @@ void OracleCatalogState::ApplyOptions(const unordered_map<string, Value> &option
 		} else if (key == "prefetch_memory") {
 			auto val = entry.second.GetValue<int64_t>();
 			settings.prefetch_memory = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "adaptive_prefetch") {
+			settings.adaptive_prefetch = entry.second.GetValue<bool>();
+		} else if (key == "fetch_target_bytes") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.fetch_target_bytes = MaxValue<idx_t>(1, static_cast<idx_t>(val));
+		} else if (key == "read_ahead") {
+			settings.read_ahead = entry.second.GetValue<bool>();
+		} else if (key == "io_threads") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.io_threads = MaxValue<idx_t>(1, static_cast<idx_t>(val));
+		} else if (key == "speculative_execute") {
+			settings.speculative_execute = entry.second.GetValue<bool>();
+		} else if (key == "point_lookup") {
+			settings.point_lookup = entry.second.GetValue<bool>();
 		} else if (key == "array_size") {
 			auto val = entry.second.GetValue<int64_t>();
 			settings.array_size = MaxValue<idx_t>(1, static_cast<idx_t>(val));
@@ -64,6 +252,42 @@ void OracleCatalogState::ApplyOptions(const unordered_map<string, Value> &option
 		} else if (key == "connection_limit") {
 			auto val = entry.second.GetValue<int64_t>();
 			settings.connection_limit = MaxValue<idx_t>(1, static_cast<idx_t>(val));
+		} else if (key == "pool_mode") {
+			auto mode = StringUtil::Lower(entry.second.ToString());
+			if (mode != "dedicated" && mode != "session_pool" && mode != "drcp") {
+				throw InvalidInputException("Oracle pool_mode must be 'dedicated', 'session_pool' or 'drcp', got '%s'",
+				                            entry.second.ToString());
+			}
+			settings.pool_mode = mode;
+		} else if (key == "connection_class") {
+			settings.connection_class = entry.second.ToString();
+		} else if (key == "min_connections") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.min_connections = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "connection_max_idle_time") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.connection_max_idle_time = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "connection_max_lifetime") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.connection_max_lifetime = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "connection_validation_interval") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.connection_validation_interval = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "reserved_connections") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.reserved_connections = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "bulk_connection_limit") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.bulk_connection_limit = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "scan_priority") {
+			auto priority = StringUtil::Lower(entry.second.ToString());
+			if (priority != "bulk" && priority != "interactive") {
+				throw InvalidInputException("Oracle scan_priority must be 'bulk' or 'interactive', got '%s'",
+				                            entry.second.ToString());
+			}
+			settings.scan_priority = priority;
+		} else if (key == "session_init") {
+			settings.session_init = entry.second.ToString();
 		} else if (key == "debug_show_queries") {
 			settings.debug_show_queries = entry.second.GetValue<bool>();
 		} else if (key == "lazy_schema_loading") {
@@ -73,6 +297,16 @@ void OracleCatalogState::ApplyOptions(const unordered_map<string, Value> &option
 		} else if (key == "metadata_result_limit") {
 			auto val = entry.second.GetValue<int64_t>();
 			settings.metadata_result_limit = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "metadata_prefetch") {
+			settings.metadata_prefetch = entry.second.GetValue<bool>();
+		} else if (key == "metadata_cache_file") {
+			settings.metadata_cache_file = entry.second.ToString();
+		} else if (key == "ddl_check_interval") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.ddl_check_interval = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "metadata_connections") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.metadata_connections = MaxValue<idx_t>(1, static_cast<idx_t>(val));
 		} else if (key == "use_current_schema") {
 			settings.use_current_schema = entry.second.GetValue<bool>();
 		} else if (key == "try_native_lobs") {
@@ -86,20 +320,68 @@ void OracleCatalogState::ApplyOptions(const unordered_map<string, Value> &option
 			settings.enable_type_conversion = entry.second.GetValue<bool>();
 		} else if (key == "enable_spatial_types") {
 			settings.enable_spatial_types = entry.second.GetValue<bool>();
+		} else if (key == "enable_statistics") {
+			settings.enable_statistics = entry.second.GetValue<bool>();
+		} else if (key == "describe_cache_size") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.describe_cache_size = val <= 0 ? 0 : static_cast<idx_t>(val);
+		} else if (key == "explain_cardinality") {
+			settings.explain_cardinality = entry.second.GetValue<bool>();
+		} else if (key == "mirror_tables") {
+			settings.mirror_tables = entry.second.ToString();
+		} else if (key == "mirror_refresh_interval") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.mirror_refresh_interval = val <= 0 ? 1 : static_cast<idx_t>(val);
+		} else if (key == "mirror_max_staleness") {
+			auto val = entry.second.GetValue<int64_t>();
+			settings.mirror_max_staleness = val <= 0 ? 0 : static_cast<idx_t>(val);
 		}
 	}
 }
 
 void OracleCatalogState::ClearCaches() {
+	vector<unique_ptr<OracleConnection>> dropped_sessions;
+	{
+		lock_guard<std::mutex> guard(lock);
+		cache_generation++;
+		catalog_version++;
+		schema_signatures.clear();
+		schema_cache.clear();
+		table_cache.clear();
+		object_cache.clear();
+		prefetched_objects.clear();
+		ddl_times.clear();
+		for (auto &shard : shards) {
+			lock_guard<std::mutex> shard_guard(shard.lock);
+			shard.columns.clear();
+			shard.statistics.clear();
+		}
+		if (!settings.metadata_cache_file.empty()) {
+			std::remove(settings.metadata_cache_file.c_str());
+		}
+		current_schema.clear();
+		version_detected = false;
+		version_info = OracleVersionInfo();
+	}
+	// Reset pooled sessions; fresh ones are connected lazily.
+	{
+		lock_guard<std::mutex> guard(session_lock);
+		session_epoch++;
+		dropped_sessions = std::move(idle_sessions);
+		idle_sessions.clear();
+	}
+}
+
+void OracleCatalogState::ResetObjectCaches() {
 	lock_guard<std::mutex> guard(lock);
-	schema_cache.clear();
-	table_cache.clear();
-	object_cache.clear();
-	current_schema.clear();
-	version_detected = false;
-	version_info = OracleVersionInfo();
-	// Reset connection if caching is enabled; a fresh connect will be created lazily.
-	connection = make_uniq<OracleConnection>();
+	cache_generation++;
+	prefetched_objects.clear();
+	ddl_times.clear();
+	for (auto &shard : shards) {
+		lock_guard<std::mutex> shard_guard(shard.lock);
+		shard.columns.clear();
+		shard.statistics.clear();
+	}
 }
 
 void OracleCatalogState::Register(const shared_ptr<OracleCatalogState> &state) {
@@ -147,37 +429,48 @@ shared_ptr<OracleCatalogState> OracleCatalogState::LookupByAlias(const string &a
 }
 
 void OracleCatalogState::DetectCurrentSchema() {
-	lock_guard<std::mutex> guard(lock);
-	if (!current_schema.empty()) {
-		return;
+	{
+		lock_guard<std::mutex> guard(lock);
+		if (!current_schema.empty()) {
+			return;
+		}
 	}
-	EnsureConnectionInternal();
 	try {
-		auto result = connection->Query("SELECT SYS_CONTEXT('USERENV', 'CURRENT_SCHEMA') FROM DUAL");
-		if (!result.rows.empty() && !result.rows[0].empty()) {
-			current_schema = result.rows[0][0];
+		auto result = QueryMetadata("SELECT SYS_CONTEXT('USERENV', 'CURRENT_SCHEMA') FROM DUAL");
+		if (result.RowCount() > 0) {
+			lock_guard<std::mutex> guard(lock);
+			current_schema = result.GetString(0, 0);
 		}
 	} catch (const std::exception &e) {
 	}
 }
 
 void OracleCatalogState::DetectOracleVersion() {
-	lock_guard<std::mutex> guard(lock);
 	if (version_detected) {
 		return;
 	}
-	EnsureConnectionInternal();
+	state_loads.Run("version", [&]() {
+		if (version_detected) {
+			return true;
+		}
+		DetectOracleVersionInternal();
+		return true;
+	});
+}
+
+void OracleCatalogState::DetectOracleVersionInternal() {
+	OracleVersionInfo info;
 	try {
 		// Try V$INSTANCE first (most reliable)
-		auto result = connection->Query("SELECT VERSION_FULL FROM V$INSTANCE");
+		auto result = QueryMetadata("SELECT VERSION_FULL FROM V$INSTANCE");
 		string version_str;
-		if (!result.rows.empty() && !result.rows[0].empty()) {
-			version_str = result.rows[0][0];
+		if (result.RowCount() > 0) {
+			version_str = result.GetString(0, 0);
 		} else {
 			// Fallback to PRODUCT_COMPONENT_VERSION
-			result = connection->Query("SELECT VERSION FROM PRODUCT_COMPONENT_VERSION WHERE ROWNUM = 1");
-			if (!result.rows.empty() && !result.rows[0].empty()) {
-				version_str = result.rows[0][0];
+			result = QueryMetadata("SELECT VERSION FROM PRODUCT_COMPONENT_VERSION WHERE ROWNUM = 1");
+			if (result.RowCount() > 0) {
+				version_str = result.GetString(0, 0);
 			}
 		}
 
@@ -186,35 +479,33 @@ void OracleCatalogState::DetectOracleVersion() {
 			auto parts = StringUtil::Split(version_str, '.');
 			if (!parts.empty()) {
 				try {
-					version_info.major = std::stoi(parts[0]);
+					info.major = std::stoi(parts[0]);
 				} catch (...) {
 				}
 			}
 			if (parts.size() >= 2) {
 				try {
-					version_info.minor = std::stoi(parts[1]);
+					info.minor = std::stoi(parts[1]);
 				} catch (...) {
 				}
 			}
 			if (parts.size() >= 3) {
 				try {
-					version_info.patch = std::stoi(parts[2]);
+					info.patch = std::stoi(parts[2]);
 				} catch (...) {
 				}
 			}
 
 			// Set feature flags based on version
-			version_info.supports_json_type = (version_info.major >= 21);
-			version_info.supports_vector = (version_info.major >= 23);
-			version_info.supports_vector_serialize =
-			    (version_info.major > 23) || (version_info.major == 23 && version_info.minor >= 4);
+			info.supports_json_type = (info.major >= 21);
+			info.supports_vector = (info.major >= 23);
+			info.supports_vector_serialize = (info.major > 23) || (info.major == 23 && info.minor >= 4);
 
 			if (settings.debug_show_queries) {
 				fprintf(stderr,
 				        "[oracle] Detected Oracle version: %d.%d.%d (JSON=%s, VECTOR=%s, VECTOR_SERIALIZE=%s)\n",
-				        version_info.major, version_info.minor, version_info.patch,
-				        version_info.supports_json_type ? "yes" : "no", version_info.supports_vector ? "yes" : "no",
-				        version_info.supports_vector_serialize ? "yes" : "no");
+				        info.major, info.minor, info.patch, info.supports_json_type ? "yes" : "no",
+				        info.supports_vector ? "yes" : "no", info.supports_vector_serialize ? "yes" : "no");
 			}
 		}
 	} catch (const std::exception &e) {
@@ -223,80 +514,95 @@ void OracleCatalogState::DetectOracleVersion() {
 			fprintf(stderr, "[oracle] Version detection failed: %s\n", e.what());
 		}
 	}
+	lock_guard<std::mutex> guard(lock);
+	version_info = info;
 	version_detected = true;
 }
 
 vector<string> OracleCatalogState::ListSchemas() {
-	lock_guard<std::mutex> guard(lock);
-	if (!schema_cache.empty()) {
-		return schema_cache;
+	{
+		lock_guard<std::mutex> guard(lock);
+		if (!schema_cache.empty()) {
+			return schema_cache;
+		}
 	}
-
-	EnsureConnectionInternal();
-
-	// Lazy loading: return only current schema by default
-	if (settings.lazy_schema_loading) {
-		if (current_schema.empty()) {
-			auto result = connection->Query("SELECT SYS_CONTEXT('USERENV', 'CURRENT_SCHEMA') FROM DUAL");
-			if (!result.rows.empty() && !result.rows[0].empty()) {
-				current_schema = result.rows[0][0];
+	return list_loads.Run("schemas", [&]() {
+		auto generation = cache_generation.load();
+		vector<string> schemas;
+		// Lazy loading: return only current schema by default
+		if (settings.lazy_schema_loading) {
+			DetectCurrentSchema();
+			auto current = GetCurrentSchema();
+			if (!current.empty()) {
+				if (settings.use_current_schema) {
+					schemas.push_back("main");
+				}
+				schemas.push_back(current);
 			}
 		}
-
-		if (!current_schema.empty()) {
-			if (settings.use_current_schema) {
-				schema_cache.push_back("main");
+		if (schemas.empty()) {
+			// Non-lazy: load all schemas
+			auto result = QueryMetadata("SELECT username FROM all_users ORDER BY username");
+			for (idx_t row = 0; row < result.RowCount(); row++) {
+				schemas.push_back(result.GetString(row, 0));
 			}
-			schema_cache.push_back(current_schema);
-			return schema_cache;
 		}
-	}
-
-	// Non-lazy: load all schemas
-	auto result = connection->Query("SELECT username FROM all_users ORDER BY username");
-	for (auto &row : result.rows) {
-		if (!row.empty()) {
-			schema_cache.push_back(row[0]);
+		lock_guard<std::mutex> guard(lock);
+		if (generation == cache_generation && schema_cache.empty()) {
+			schema_cache = schemas;
 		}
-	}
-	return schema_cache;
+		return schemas;
+	});
 }
 
 vector<string> OracleCatalogState::ListTables(const string &schema) {
-	lock_guard<std::mutex> guard(lock);
-	auto entry = table_cache.find(schema);
-	if (entry != table_cache.end()) {
-		return entry->second;
-	}
-	EnsureConnectionInternal();
-
 	if (schema.empty()) {
 		return {};
 	}
-
-	auto query = StringUtil::Format("SELECT table_name FROM all_tables WHERE owner = UPPER(%s) ORDER BY table_name",
-	                                Value(schema).ToSQLString().c_str());
-	auto result = connection->Query(query);
-	vector<string> tables;
-	for (auto &row : result.rows) {
-		if (!row.empty()) {
-			tables.push_back(row[0]);
+	{
+		lock_guard<std::mutex> guard(lock);
+		auto entry = table_cache.find(schema);
+		if (entry != table_cache.end()) {
+			return entry->second;
 		}
 	}
-	table_cache.emplace(schema, tables);
-	return tables;
+	return list_loads.Run("tables:" + schema, [&]() {
+		auto generation = cache_generation.load();
+		WatchSchema(schema);
+		TrackDdlTimes(schema);
+
+		auto query = StringUtil::Format("SELECT table_name FROM all_tables WHERE owner = UPPER(%s) ORDER BY table_name",
+		                                Value(schema).ToSQLString().c_str());
+		auto result = QueryMetadata(query);
+		vector<string> tables;
+		for (idx_t row = 0; row < result.RowCount(); row++) {
+			tables.push_back(result.GetString(row, 0));
+		}
+		lock_guard<std::mutex> guard(lock);
+		if (generation == cache_generation) {
+			table_cache.emplace(schema, tables);
+		}
+		return tables;
+	});
 }
 
 vector<string> OracleCatalogState::ListObjects(const string &schema, const string &object_types) {
-	lock_guard<std::mutex> guard(lock);
-
 	auto cache_key = schema + ":" + object_types;
-	auto entry = object_cache.find(cache_key);
-	if (entry != object_cache.end()) {
-		return entry->second;
+	{
+		lock_guard<std::mutex> guard(lock);
+		auto entry = object_cache.find(cache_key);
+		if (entry != object_cache.end()) {
+			return entry->second;
+		}
 	}
+	return list_loads.Run("objects:" + cache_key, [&]() { return LoadObjects(schema, object_types, cache_key); });
+}
 
-	EnsureConnectionInternal();
+vector<string> OracleCatalogState::LoadObjects(const string &schema, const string &object_types,
+                                               const string &cache_key) {
+	auto generation = cache_generation.load();
+	WatchSchema(schema);
+	TrackDdlTimes(schema);
 
 	// Build IN clause from comma-separated object_types
 	auto types = StringUtil::Split(object_types, ',');
@@ -319,12 +625,10 @@ vector<string> OracleCatalogState::ListObjects(const string &schema, const strin
 		                           static_cast<uint64_t>(settings.metadata_result_limit));
 	}
 
-	auto result = connection->Query(query);
+	auto result = QueryMetadata(query);
 	vector<string> objects;
-	for (auto &row : result.rows) {
-		if (!row.empty()) {
-			objects.push_back(row[0]);
-		}
+	for (idx_t row = 0; row < result.RowCount(); row++) {
+		objects.push_back(result.GetString(row, 0));
 	}
 
 	// Log warning if limit reached
@@ -337,14 +641,14 @@ vector<string> OracleCatalogState::ListObjects(const string &schema, const strin
 		        (unsigned long)settings.metadata_result_limit);
 	}
 
-	object_cache.emplace(cache_key, objects);
+	lock_guard<std::mutex> guard(lock);
+	if (generation == cache_generation) {
+		object_cache.emplace(cache_key, objects);
+	}
 	return objects;
 }
 
 pair<string, string> OracleCatalogState::ResolveSynonym(const string &schema, const string &synonym_name, bool &found) {
-	lock_guard<std::mutex> guard(lock);
-	EnsureConnectionInternal();
-
 	auto query = StringUtil::Format("SELECT table_owner, table_name FROM all_synonyms "
 	                                "WHERE synonym_name = UPPER(%s) "
 	                                "AND (owner = UPPER(%s) OR owner = 'PUBLIC') "
@@ -352,59 +656,608 @@ pair<string, string> OracleCatalogState::ResolveSynonym(const string &schema, co
 	                                Value(synonym_name).ToSQLString().c_str(), Value(schema).ToSQLString().c_str(),
 	                                Value(schema).ToSQLString().c_str());
 
-	auto result = connection->Query(query);
-	if (result.rows.empty()) {
+	auto result = QueryMetadata(query);
+	if (result.RowCount() == 0) {
 		found = false;
 		return std::make_pair("", "");
 	}
 
 	found = true;
-	return std::make_pair(result.rows[0][0], result.rows[0][1]);
+	return std::make_pair(result.GetString(0, 0), result.GetString(0, 1));
 }
 
 bool OracleCatalogState::ObjectExists(const string &schema, const string &object_name, const string &object_types) {
-	lock_guard<std::mutex> guard(lock);
-	EnsureConnectionInternal();
-
 	auto query = StringUtil::Format("SELECT 1 FROM all_objects "
 	                                "WHERE owner = UPPER(%s) AND object_name = UPPER(%s) "
 	                                "AND object_type IN (%s)",
 	                                Value(schema).ToSQLString().c_str(), Value(object_name).ToSQLString().c_str(),
 	                                object_types.c_str());
 
-	auto result = connection->Query(query);
-	return !result.rows.empty();
+	auto result = QueryMetadata(query);
+	return result.RowCount() > 0;
 }
 
 string OracleCatalogState::GetObjectName(const string &schema, const string &object_name, const string &object_types) {
-	lock_guard<std::mutex> guard(lock);
-	EnsureConnectionInternal();
-
+	{
+		lock_guard<std::mutex> guard(lock);
+		auto prefetched = prefetched_objects.find(StringUtil::Upper(schema));
+		if (prefetched != prefetched_objects.end()) {
+			auto object = prefetched->second.find(StringUtil::Upper(object_name));
+			if (object != prefetched->second.end()) {
+				return object->second;
+			}
+		}
+	}
 	auto query = StringUtil::Format("SELECT object_name FROM all_objects "
 	                                "WHERE owner = UPPER(%s) AND UPPER(object_name) = UPPER(%s) "
 	                                "AND object_type IN (%s)",
 	                                Value(schema).ToSQLString().c_str(), Value(object_name).ToSQLString().c_str(),
 	                                object_types.c_str());
+	// Many binds resolving the same table at once share one lookup.
+	return name_loads.Run(query, [&]() {
+		auto result = QueryMetadata(query);
+		return result.RowCount() > 0 ? result.GetString(0, 0) : string();
+	});
+}
 
-	auto result = connection->Query(query);
-	if (!result.rows.empty()) {
-		return result.rows[0][0];
+string OracleCatalogState::GetRealSchemaName(const string &name) {
+	auto query = StringUtil::Format("SELECT username FROM all_users WHERE UPPER(username) = UPPER(%s)",
+	                                Value(name).ToSQLString().c_str());
+
+	auto result = QueryMetadata(query);
+	if (result.RowCount() > 0) {
+		return result.GetString(0, 0);
 	}
 	return "";
 }
 
-string OracleCatalogState::GetRealSchemaName(const string &name) {
+vector<OracleColumnInfo> OracleCatalogState::GetColumns(const string &schema, const string &table) {
+	if (settings.metadata_prefetch) {
+		PrefetchSchema(schema);
+	}
+	auto key = ColumnCacheKey(schema, table);
+	auto &shard = ShardFor(key);
+	{
+		lock_guard<std::mutex> guard(shard.lock);
+		auto entry = shard.columns.find(key);
+		if (entry != shard.columns.end()) {
+			return entry->second;
+		}
+	}
+	return column_loads.Run(key, [&]() {
+		auto generation = cache_generation.load();
+		WatchSchema(schema);
+		TrackDdlTimes(schema);
+
+		auto query = StringUtil::Format(
+		    "SELECT column_name, data_type, data_length, data_precision, data_scale, nullable "
+		    "FROM all_tab_columns WHERE owner = UPPER(%s) AND table_name = UPPER(%s) "
+		    "ORDER BY column_id",
+		    Value(schema).ToSQLString().c_str(), Value(table).ToSQLString().c_str());
+		auto result = QueryMetadata(query);
+		vector<OracleColumnInfo> columns;
+		for (idx_t row = 0; row < result.RowCount(); row++) {
+			columns.push_back(ParseColumnInfo(result, row, 0));
+		}
+		lock_guard<std::mutex> guard(shard.lock);
+		if (generation == cache_generation) {
+			shard.columns.emplace(key, columns);
+		}
+		return columns;
+	});
+}
+
+void OracleCatalogState::PrefetchSchema(const string &schema) {
+	auto schema_key = StringUtil::Upper(schema);
+	if (schema.empty()) {
+		return;
+	}
+	auto prefetched = [&]() {
+		lock_guard<std::mutex> guard(lock);
+		return prefetched_objects.find(schema_key) != prefetched_objects.end();
+	};
+	if (prefetched()) {
+		return;
+	}
+	state_loads.Run("prefetch:" + schema_key, [&]() {
+		// Re-check: a flight that finished just before this one started may have loaded the schema.
+		if (prefetched()) {
+			return true;
+		}
+		PrefetchSchemaInternal(schema);
+		return true;
+	});
+}
+
+void OracleCatalogState::PrefetchSchemaInternal(const string &schema) {
+	auto generation = cache_generation.load();
+	WatchSchema(schema);
+	TrackDdlTimes(schema);
+
+	// One statement for the whole schema; OracleConnection::Query array-fetches the rows.
+	auto query = StringUtil::Format("SELECT table_name, column_name, data_type, data_length, data_precision, "
+	                                "data_scale, nullable FROM all_tab_columns WHERE owner = UPPER(%s) "
+	                                "ORDER BY table_name, column_id",
+	                                Value(schema).ToSQLString().c_str());
+	auto result = QueryMetadata(query);
+	unordered_map<string, string> objects;
+	unordered_map<string, vector<OracleColumnInfo>> columns;
+	for (idx_t row = 0; row < result.RowCount(); row++) {
+		auto table = result.GetString(row, 0);
+		objects.emplace(StringUtil::Upper(table), table);
+		columns[ColumnCacheKey(schema, table)].push_back(ParseColumnInfo(result, row, 1));
+	}
+	auto object_count = objects.size();
+	{
+		lock_guard<std::mutex> guard(lock);
+		if (generation != cache_generation) {
+			return;
+		}
+		for (auto &entry : columns) {
+			auto &shard = ShardFor(entry.first);
+			lock_guard<std::mutex> shard_guard(shard.lock);
+			shard.columns[entry.first] = std::move(entry.second);
+		}
+		// Published last: GetObjectName trusts prefetched names only once their columns are cached.
+		prefetched_objects[StringUtil::Upper(schema)] = std::move(objects);
+	}
+	// Persist right away: short-lived processes may not reach a clean shutdown.
+	try {
+		SaveMetadataCache();
+	} catch (std::exception &ex) {
+		if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+			fprintf(stderr, "[oracle] failed to save metadata cache: %s\n", ex.what());
+		}
+	}
+
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] prefetched %llu columns for %llu objects in schema %s\n",
+		        static_cast<unsigned long long>(result.RowCount()), static_cast<unsigned long long>(object_count),
+		        schema.c_str());
+	}
+}
+
+unordered_map<string, string> OracleCatalogState::QueryDdlTimes(const string &schema) {
+	auto query = StringUtil::Format("SELECT object_name, %s FROM all_objects "
+	                                "WHERE owner = UPPER(%s) AND object_type IN (%s) GROUP BY object_name",
+	                                METADATA_DDL_TIME, Value(schema).ToSQLString().c_str(),
+	                                METADATA_CACHE_OBJECT_TYPES);
+	auto result = QueryMetadata(query);
+	unordered_map<string, string> times;
+	for (idx_t row = 0; row < result.RowCount(); row++) {
+		times[result.GetString(row, 0)] = result.GetString(row, 1);
+	}
+	return times;
+}
+
+void OracleCatalogState::TrackDdlTimes(const string &schema) {
+	// Read DDL times before the schema's metadata is cached, so DDL racing with the load looks newer next time.
+	if (settings.metadata_cache_file.empty() || schema.empty()) {
+		return;
+	}
+	auto schema_key = StringUtil::Upper(schema);
+	{
+		lock_guard<std::mutex> guard(lock);
+		if (ddl_times.find(schema_key) != ddl_times.end()) {
+			return;
+		}
+	}
+	state_loads.Run("ddl:" + schema_key, [&]() {
+		auto generation = cache_generation.load();
+		auto times = QueryDdlTimes(schema);
+		lock_guard<std::mutex> guard(lock);
+		if (generation == cache_generation) {
+			ddl_times.emplace(schema_key, std::move(times));
+		}
+		return true;
+	});
+}
+
+idx_t OracleCatalogState::GetCatalogVersion() {
+	if (settings.ddl_check_interval > 0) {
+		auto now = std::chrono::steady_clock::now();
+		bool due;
+		{
+			lock_guard<std::mutex> guard(lock);
+			due = !schema_signatures.empty() &&
+			      now - last_ddl_check >= std::chrono::seconds(static_cast<int64_t>(settings.ddl_check_interval));
+			if (due) {
+				// Claimed before polling: concurrent callers keep the current version instead of polling too.
+				last_ddl_check = now;
+			}
+		}
+		if (due) {
+			try {
+				CheckForDdl();
+			} catch (std::exception &ex) {
+				if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+					fprintf(stderr, "[oracle] DDL check failed: %s\n", ex.what());
+				}
+			}
+		}
+	}
+	return catalog_version;
+}
+
+unordered_map<string, string> OracleCatalogState::QuerySchemaSignatures(const vector<string> &schemas) {
+	vector<string> quoted;
+	for (auto &schema : schemas) {
+		quoted.push_back(Value(schema).ToSQLString());
+	}
+	// Object count catches drops; the newest LAST_DDL_TIME catches creates and alters.
+	auto query = StringUtil::Format("SELECT owner, COUNT(*), %s FROM all_objects "
+	                                "WHERE owner IN (%s) AND object_type IN (%s) GROUP BY owner",
+	                                METADATA_DDL_TIME, StringUtil::Join(quoted, ",").c_str(),
+	                                METADATA_CACHE_OBJECT_TYPES);
+	auto result = QueryMetadata(query);
+	unordered_map<string, string> signatures;
+	for (idx_t row = 0; row < result.RowCount(); row++) {
+		signatures[result.GetString(row, 0)] = result.GetString(row, 1) + "@" + result.GetString(row, 2);
+	}
+	return signatures;
+}
+
+void OracleCatalogState::WatchSchema(const string &schema) {
+	if (settings.ddl_check_interval == 0 || schema.empty()) {
+		return;
+	}
+	auto schema_key = StringUtil::Upper(schema);
+	{
+		lock_guard<std::mutex> guard(lock);
+		if (schema_signatures.find(schema_key) != schema_signatures.end()) {
+			return;
+		}
+	}
+	auto signatures = QuerySchemaSignatures({schema_key});
 	lock_guard<std::mutex> guard(lock);
-	EnsureConnectionInternal();
+	if (schema_signatures.empty()) {
+		last_ddl_check = std::chrono::steady_clock::now();
+	}
+	schema_signatures.emplace(schema_key, signatures[schema_key]);
+}
 
-	auto query = StringUtil::Format("SELECT username FROM all_users WHERE UPPER(username) = UPPER(%s)",
-	                                Value(name).ToSQLString().c_str());
+void OracleCatalogState::CheckForDdl() {
+	vector<string> schemas;
+	{
+		lock_guard<std::mutex> guard(lock);
+		for (auto &entry : schema_signatures) {
+			schemas.push_back(entry.first);
+		}
+	}
+	if (schemas.empty()) {
+		return;
+	}
+	auto current = QuerySchemaSignatures(schemas);
+
+	vector<string> changed;
+	{
+		lock_guard<std::mutex> guard(lock);
+		for (auto &schema : schemas) {
+			auto entry = schema_signatures.find(schema);
+			if (entry == schema_signatures.end()) {
+				continue; // cleared concurrently
+			}
+			auto &signature = current[schema];
+			if (!DdlTimeMatches(entry->second, signature)) {
+				changed.push_back(schema);
+				entry->second = signature;
+			}
+		}
+		if (changed.empty()) {
+			return;
+		}
+		// Cached object metadata predates the DDL; drop it so re-binds load the new definitions.
+		cache_generation++;
+		table_cache.clear();
+		object_cache.clear();
+		prefetched_objects.clear();
+		ddl_times.clear();
+		for (auto &shard : shards) {
+			lock_guard<std::mutex> shard_guard(shard.lock);
+			shard.columns.clear();
+			shard.statistics.clear();
+		}
+		catalog_version++;
+	}
+	// oracle_query describes are cached per SQL text and may cover the changed objects too.
+	OracleClearDescribeCache();
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] DDL detected in %s; catalog version is now %llu\n",
+		        StringUtil::Join(changed, ", ").c_str(), static_cast<unsigned long long>(catalog_version.load()));
+	}
+}
 
-	auto result = connection->Query(query);
-	if (!result.rows.empty()) {
-		return result.rows[0][0];
+void OracleCatalogState::LoadMetadataCache() {
+	if (settings.metadata_cache_file.empty()) {
+		return;
 	}
-	return "";
+	std::ifstream in(settings.metadata_cache_file);
+	if (!in.is_open()) {
+		return;
+	}
+	string line;
+	if (!std::getline(in, line)) {
+		return;
+	}
+	auto header = SplitCacheLine(line);
+	if (header.size() != 3 || header[0] != METADATA_CACHE_MAGIC || header[1] != METADATA_CACHE_VERSION ||
+	    header[2] != ConnectionFingerprint(connection_string)) {
+		return;
+	}
+
+	vector<string> cached_schemas;
+	unordered_map<string, vector<string>> cached_tables;
+	unordered_map<string, vector<string>> cached_objects;
+	unordered_map<string, vector<OracleColumnInfo>> cached_columns;
+	unordered_map<string, unordered_map<string, string>> cached_prefetched;
+	unordered_map<string, unordered_map<string, string>> cached_ddl_times;
+	while (std::getline(in, line)) {
+		auto fields = SplitCacheLine(line);
+		auto &tag = fields[0];
+		if (tag == "S" && fields.size() == 2) {
+			cached_schemas.push_back(fields[1]);
+		} else if ((tag == "T" || tag == "O") && fields.size() >= 2) {
+			auto &target = tag == "T" ? cached_tables : cached_objects;
+			target[fields[1]] = vector<string>(fields.begin() + 2, fields.end());
+		} else if (tag == "C" && fields.size() >= 2 && (fields.size() - 2) % 6 == 0) {
+			auto &columns = cached_columns[fields[1]];
+			for (idx_t i = 2; i < fields.size(); i += 6) {
+				columns.push_back(ParseColumnInfo(fields, i));
+			}
+		} else if ((tag == "P" || tag == "D") && fields.size() >= 2 && fields.size() % 2 == 0) {
+			auto &target = tag == "P" ? cached_prefetched[fields[1]] : cached_ddl_times[fields[1]];
+			for (idx_t i = 2; i + 1 < fields.size(); i += 2) {
+				target[fields[i]] = fields[i + 1];
+			}
+		}
+	}
+
+	// Validate against the current dictionary: one grouped ALL_OBJECTS query per cached schema.
+	auto generation = cache_generation.load();
+	unordered_map<string, unordered_map<string, string>> validated_ddl_times;
+	idx_t dropped = 0;
+	for (auto &schema_entry : cached_ddl_times) {
+		auto &schema_key = schema_entry.first;
+		auto current = QueryDdlTimes(schema_key);
+		bool objects_changed = current.size() != schema_entry.second.size();
+		for (auto &object : schema_entry.second) {
+			auto now = current.find(object.first);
+			if (now == current.end()) {
+				objects_changed = true;
+			}
+			if (now == current.end() || !DdlTimeMatches(object.second, now->second)) {
+				dropped += cached_columns.erase(schema_key + "." + object.first);
+			}
+		}
+		for (auto &object : current) {
+			if (schema_entry.second.find(object.first) == schema_entry.second.end()) {
+				objects_changed = true;
+			}
+		}
+		if (objects_changed) {
+			// Object lists of this schema are stale; prefetched names are narrowed to existing objects.
+			for (auto it = cached_tables.begin(); it != cached_tables.end();) {
+				it = StringUtil::Upper(it->first) == schema_key ? cached_tables.erase(it) : std::next(it);
+			}
+			for (auto it = cached_objects.begin(); it != cached_objects.end();) {
+				auto object_schema = StringUtil::Upper(it->first.substr(0, it->first.find(':')));
+				it = object_schema == schema_key ? cached_objects.erase(it) : std::next(it);
+			}
+			auto prefetched = cached_prefetched.find(schema_key);
+			if (prefetched != cached_prefetched.end()) {
+				for (auto it = prefetched->second.begin(); it != prefetched->second.end();) {
+					it = current.find(it->second) == current.end() ? prefetched->second.erase(it) : std::next(it);
+				}
+			}
+		}
+		validated_ddl_times[schema_key] = std::move(current);
+	}
+	// Columns are only trusted with a DDL baseline read before they were loaded. Objects created after their schema's
+	// baseline, and schemas without one, have none and are reloaded.
+	for (auto it = cached_columns.begin(); it != cached_columns.end();) {
+		auto dot = it->first.find('.');
+		auto schema_times = cached_ddl_times.find(it->first.substr(0, dot));
+		bool has_baseline = dot != string::npos && schema_times != cached_ddl_times.end() &&
+		                    schema_times->second.find(it->first.substr(dot + 1)) != schema_times->second.end();
+		if (has_baseline) {
+			++it;
+		} else {
+			it = cached_columns.erase(it);
+			dropped++;
+		}
+	}
+	if (!settings.lazy_schema_loading) {
+		// all_users is not covered by LAST_DDL_TIME validation.
+		cached_schemas.clear();
+	}
+
+	lock_guard<std::mutex> guard(lock);
+	if (generation != cache_generation) {
+		return;
+	}
+	for (auto &entry : validated_ddl_times) {
+		ddl_times[entry.first] = std::move(entry.second);
+	}
+	if (schema_cache.empty()) {
+		schema_cache = std::move(cached_schemas);
+	}
+	for (auto &entry : cached_tables) {
+		table_cache.emplace(entry.first, std::move(entry.second));
+	}
+	for (auto &entry : cached_objects) {
+		object_cache.emplace(entry.first, std::move(entry.second));
+	}
+	auto cached_tables_count = cached_columns.size();
+	for (auto &entry : cached_columns) {
+		auto &shard = ShardFor(entry.first);
+		lock_guard<std::mutex> shard_guard(shard.lock);
+		shard.columns.emplace(entry.first, std::move(entry.second));
+	}
+	for (auto &entry : cached_prefetched) {
+		prefetched_objects.emplace(entry.first, std::move(entry.second));
+	}
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] metadata cache loaded: %llu tables, %llu invalidated by DDL\n",
+		        static_cast<unsigned long long>(cached_tables_count), static_cast<unsigned long long>(dropped));
+	}
+}
+
+void OracleCatalogState::SaveMetadataCache() {
+	if (settings.metadata_cache_file.empty()) {
+		return;
+	}
+	auto contents = SerializeMetadataCache();
+	if (contents.empty()) {
+		return;
+	}
+
+	// Write to a temporary file and rename, so concurrent writers never produce a partial cache. The name is unique
+	// per process (PID) and per save within it, since several processes may share one cache file.
+	static std::atomic<idx_t> save_sequence {0};
+	auto temp_path = settings.metadata_cache_file + ".tmp" + std::to_string(static_cast<int64_t>(getpid())) + "." +
+	                 std::to_string(save_sequence++);
+	{
+		std::ofstream out(temp_path, std::ios::out | std::ios::trunc);
+		if (!out.is_open()) {
+			throw IOException("Failed to write Oracle metadata cache file: " + temp_path);
+		}
+		out << contents;
+	}
+	if (std::rename(temp_path.c_str(), settings.metadata_cache_file.c_str()) != 0) {
+		std::remove(temp_path.c_str());
+		throw IOException("Failed to replace Oracle metadata cache file: " + settings.metadata_cache_file);
+	}
+}
+
+string OracleCatalogState::SerializeMetadataCache() {
+	lock_guard<std::mutex> guard(lock);
+	if (ddl_times.empty()) {
+		return string();
+	}
+	// Only entries of schemas with recorded DDL times can be validated later.
+	auto validated = [&](const string &schema) {
+		return ddl_times.find(StringUtil::Upper(schema)) != ddl_times.end();
+	};
+	auto fingerprint = ConnectionFingerprint(connection_string);
+	string contents = CacheLine(METADATA_CACHE_MAGIC, {METADATA_CACHE_VERSION, fingerprint});
+	for (auto &schema : schema_cache) {
+		contents += CacheLine("S", {schema});
+	}
+	for (auto &entry : table_cache) {
+		if (validated(entry.first)) {
+			vector<string> fields {entry.first};
+			fields.insert(fields.end(), entry.second.begin(), entry.second.end());
+			contents += CacheLine("T", fields);
+		}
+	}
+	for (auto &entry : object_cache) {
+		if (validated(entry.first.substr(0, entry.first.find(':')))) {
+			vector<string> fields {entry.first};
+			fields.insert(fields.end(), entry.second.begin(), entry.second.end());
+			contents += CacheLine("O", fields);
+		}
+	}
+	for (auto &shard : shards) {
+		lock_guard<std::mutex> shard_guard(shard.lock);
+		for (auto &entry : shard.columns) {
+			if (!validated(entry.first.substr(0, entry.first.find('.')))) {
+				continue;
+			}
+			vector<string> fields {entry.first};
+			for (auto &column : entry.second) {
+				fields.push_back(column.name);
+				fields.push_back(column.data_type);
+				fields.push_back(std::to_string(column.data_length));
+				fields.push_back(std::to_string(column.precision));
+				fields.push_back(std::to_string(column.scale));
+				fields.push_back(column.nullable ? "Y" : "N");
+			}
+			contents += CacheLine("C", fields);
+		}
+	}
+	for (auto &entry : prefetched_objects) {
+		vector<string> fields {entry.first};
+		for (auto &object : entry.second) {
+			fields.push_back(object.first);
+			fields.push_back(object.second);
+		}
+		contents += CacheLine("P", fields);
+	}
+	for (auto &entry : ddl_times) {
+		vector<string> fields {entry.first};
+		for (auto &object : entry.second) {
+			fields.push_back(object.first);
+			fields.push_back(object.second);
+		}
+		contents += CacheLine("D", fields);
+	}
+
+	return contents;
+}
+
+shared_ptr<OracleTableStatistics> OracleCatalogState::GetTableStatistics(const string &schema, const string &table) {
+	auto key = schema + "." + table;
+	auto &shard = ShardFor(key);
+	{
+		lock_guard<std::mutex> guard(shard.lock);
+		auto it = shard.statistics.find(key);
+		if (it != shard.statistics.end()) {
+			return it->second;
+		}
+	}
+	return statistics_loads.Run(key, [&]() { return LoadTableStatistics(schema, table, key); });
+}
+
+shared_ptr<OracleTableStatistics> OracleCatalogState::LoadTableStatistics(const string &schema, const string &table,
+                                                                          const string &key) {
+	auto generation = cache_generation.load();
+	auto stats = make_shared_ptr<OracleTableStatistics>();
+	auto table_query = StringUtil::Format("SELECT num_rows FROM all_tab_statistics "
+	                                      "WHERE owner = %s AND table_name = %s AND object_type = 'TABLE'",
+	                                      Value(schema).ToSQLString().c_str(), Value(table).ToSQLString().c_str());
+	auto table_result = QueryMetadata(table_query);
+	if (table_result.RowCount() > 0 && !table_result.IsNull(0, 0)) {
+		stats->has_row_count = true;
+		stats->num_rows = static_cast<idx_t>(table_result.GetInt64(0, 0));
+	}
+
+	auto column_query = StringUtil::Format("SELECT column_name, num_distinct FROM all_tab_col_statistics "
+	                                       "WHERE owner = %s AND table_name = %s AND num_distinct IS NOT NULL",
+	                                       Value(schema).ToSQLString().c_str(), Value(table).ToSQLString().c_str());
+	auto column_result = QueryMetadata(column_query);
+	for (idx_t row = 0; row < column_result.RowCount(); row++) {
+		OracleColumnStatistics column;
+		column.num_distinct = static_cast<idx_t>(column_result.GetInt64(row, 1));
+		stats->columns[column_result.GetString(row, 0)] = column;
+	}
+
+	auto key_query = StringUtil::Format("SELECT c.index_name, c.column_name FROM all_indexes i JOIN all_ind_columns c "
+	                                    "ON c.index_owner = i.owner AND c.index_name = i.index_name "
+	                                    "WHERE i.table_owner = %s AND i.table_name = %s AND i.uniqueness = 'UNIQUE' "
+	                                    "ORDER BY c.index_name, c.column_position",
+	                                    Value(schema).ToSQLString().c_str(), Value(table).ToSQLString().c_str());
+	auto key_result = QueryMetadata(key_query);
+	string index_name;
+	for (idx_t row = 0; row < key_result.RowCount(); row++) {
+		if (stats->unique_keys.empty() || key_result.GetString(row, 0) != index_name) {
+			index_name = key_result.GetString(row, 0);
+			stats->unique_keys.emplace_back();
+		}
+		stats->unique_keys.back().push_back(key_result.GetString(row, 1));
+	}
+
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] statistics %s.%s: rows=%s columns=%llu unique keys=%llu\n", schema.c_str(),
+		        table.c_str(), stats->has_row_count ? std::to_string(stats->num_rows).c_str() : "unknown",
+		        static_cast<unsigned long long>(stats->columns.size()),
+		        static_cast<unsigned long long>(stats->unique_keys.size()));
+	}
+	auto &shard = ShardFor(key);
+	lock_guard<std::mutex> guard(shard.lock);
+	if (generation == cache_generation) {
+		shard.statistics[key] = stats;
+	}
+	return stats;
 }
 
 } // namespace duckdb
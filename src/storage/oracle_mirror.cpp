@@ -0,0 +1,373 @@
+#include "oracle_mirror.hpp"
+#include "oracle_connection.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/storage/statistics/node_statistics.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+namespace duckdb {
+
+namespace {
+
+struct OracleMirrorBindData : public TableFunctionData {
+	shared_ptr<OracleMirrorSnapshot> snapshot;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto result = make_uniq<OracleMirrorBindData>();
+		result->snapshot = snapshot;
+		return std::move(result);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<OracleMirrorBindData>();
+		return snapshot == other.snapshot;
+	}
+};
+
+struct OracleMirrorScanState : public GlobalTableFunctionState {
+	ColumnDataScanState scan_state;
+};
+
+} // namespace
+
+static unique_ptr<GlobalTableFunctionState> OracleMirrorInitGlobal(ClientContext &, TableFunctionInitInput &input) {
+	auto &bind = input.bind_data->Cast<OracleMirrorBindData>();
+	auto result = make_uniq<OracleMirrorScanState>();
+	bind.snapshot->data->InitializeScan(result->scan_state);
+	return std::move(result);
+}
+
+static void OracleMirrorScan(ClientContext &, TableFunctionInput &data, DataChunk &output) {
+	auto &bind = data.bind_data->Cast<OracleMirrorBindData>();
+	auto &gstate = data.global_state->Cast<OracleMirrorScanState>();
+	bind.snapshot->data->Scan(gstate.scan_state, output);
+}
+
+static unique_ptr<NodeStatistics> OracleMirrorCardinality(ClientContext &, const FunctionData *bind_data_p) {
+	auto &bind = bind_data_p->Cast<OracleMirrorBindData>();
+	auto count = bind.snapshot->data->Count();
+	return make_uniq<NodeStatistics>(count, count);
+}
+
+TableFunction OracleMirrorScanFunction(shared_ptr<OracleMirrorSnapshot> snapshot, unique_ptr<FunctionData> &bind_data) {
+	auto bind = make_uniq<OracleMirrorBindData>();
+	bind->snapshot = std::move(snapshot);
+	bind_data = std::move(bind);
+
+	TableFunction tf({}, OracleMirrorScan, nullptr, OracleMirrorInitGlobal, nullptr);
+	tf.cardinality = OracleMirrorCardinality;
+	tf.projection_pushdown = false;
+	tf.filter_pushdown = false;
+	return tf;
+}
+
+static string RowKey(DataChunk &chunk, idx_t row, const vector<idx_t> &key_columns) {
+	string key;
+	for (auto col : key_columns) {
+		key += chunk.GetValue(col, row).ToString();
+		key += '\x1f';
+	}
+	return key;
+}
+
+//! Replace every row of base whose key appears in delta by the delta row.
+static shared_ptr<ColumnDataCollection> MergeByKey(ColumnDataCollection &base, ColumnDataCollection &delta,
+                                                   const vector<idx_t> &key_columns) {
+	unordered_set<string> changed;
+	for (auto &chunk : delta.Chunks()) {
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			changed.insert(RowKey(chunk, row, key_columns));
+		}
+	}
+
+	auto merged = make_shared_ptr<ColumnDataCollection>(Allocator::DefaultAllocator(), base.Types());
+	for (auto &chunk : base.Chunks()) {
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		idx_t keep = 0;
+		for (idx_t row = 0; row < chunk.size(); row++) {
+			if (changed.find(RowKey(chunk, row, key_columns)) == changed.end()) {
+				sel.set_index(keep++, row);
+			}
+		}
+		if (keep == chunk.size()) {
+			merged->Append(chunk);
+		} else if (keep > 0) {
+			chunk.Slice(sel, keep);
+			merged->Append(chunk);
+		}
+	}
+	for (auto &chunk : delta.Chunks()) {
+		merged->Append(chunk);
+	}
+	return merged;
+}
+
+static vector<idx_t> LoadPrimaryKey(OracleConnection &conn, const OracleMirrorDefinition &definition) {
+	auto query = StringUtil::Format("SELECT cc.column_name FROM all_constraints c "
+	                                "JOIN all_cons_columns cc ON cc.owner = c.owner "
+	                                "AND cc.constraint_name = c.constraint_name "
+	                                "WHERE c.constraint_type = 'P' AND c.owner = %s AND c.table_name = %s "
+	                                "ORDER BY cc.position",
+	                                Value(definition.schema_name).ToSQLString().c_str(),
+	                                Value(definition.table_name).ToSQLString().c_str());
+	auto result = conn.Query(query);
+	vector<idx_t> key_columns;
+	for (idx_t row = 0; row < result.RowCount(); row++) {
+		auto column_name = result.GetString(row, 0);
+		idx_t found = DConstants::INVALID_INDEX;
+		for (idx_t i = 0; i < definition.names.size(); i++) {
+			if (definition.names[i] == column_name) {
+				found = i;
+				break;
+			}
+		}
+		if (found == DConstants::INVALID_INDEX) {
+			// Key column is not part of the mirrored projection; merge cannot be trusted.
+			return {};
+		}
+		key_columns.push_back(found);
+	}
+	return key_columns;
+}
+
+OracleMirrorManager::OracleMirrorManager(string connection_string_p, const OracleSettings &settings_p)
+    : connection_string(std::move(connection_string_p)), settings(settings_p) {
+	for (auto &name : StringUtil::Split(settings.mirror_tables, ',')) {
+		StringUtil::Trim(name);
+		if (!name.empty()) {
+			patterns.push_back(StringUtil::Upper(name));
+		}
+	}
+}
+
+OracleMirrorManager::~OracleMirrorManager() {
+	Stop();
+}
+
+string OracleMirrorManager::EntryKey(const string &schema_name, const string &table_name) {
+	return schema_name + "." + table_name;
+}
+
+bool OracleMirrorManager::IsMirrored(const string &schema_name, const string &table_name) const {
+	auto table = StringUtil::Upper(table_name);
+	auto qualified = StringUtil::Upper(schema_name) + "." + table;
+	for (auto &pattern : patterns) {
+		if (pattern == table || pattern == qualified) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void OracleMirrorManager::Register(OracleMirrorDefinition definition) {
+	auto key = EntryKey(definition.schema_name, definition.table_name);
+	std::lock_guard<std::mutex> guard(lock);
+	if (entries.find(key) != entries.end()) {
+		return;
+	}
+	auto entry = make_shared_ptr<MirrorEntry>();
+	entry->definition = std::move(definition);
+	entry->next_refresh = std::chrono::steady_clock::now();
+	entries.emplace(key, std::move(entry));
+	cv.notify_all();
+}
+
+shared_ptr<OracleMirrorSnapshot> OracleMirrorManager::GetFreshSnapshot(const string &schema_name,
+                                                                        const string &table_name) {
+	std::lock_guard<std::mutex> guard(lock);
+	auto it = entries.find(EntryKey(schema_name, table_name));
+	if (it == entries.end() || !it->second->snapshot) {
+		return nullptr;
+	}
+	auto &snapshot = it->second->snapshot;
+	auto age = std::chrono::steady_clock::now() - snapshot->refreshed_at;
+	if (age > std::chrono::seconds(settings.mirror_max_staleness)) {
+		return nullptr;
+	}
+	return snapshot;
+}
+
+void OracleMirrorManager::Start(DatabaseInstance &db) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (worker.joinable() || stopped) {
+		return;
+	}
+	database = db.shared_from_this();
+	// The worker keeps the manager alive so that it can outlive the catalog state during shutdown.
+	auto self = shared_from_this();
+	worker = std::thread([self]() { self->RefreshLoop(); });
+}
+
+void OracleMirrorManager::Stop() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopped = true;
+		if (active_context) {
+			// Breaks the Oracle fetch of the refresh in progress (OracleInterruptGuard).
+			active_context->Interrupt();
+		}
+		cv.notify_all();
+	}
+	if (!worker.joinable()) {
+		return;
+	}
+	if (worker.get_id() == std::this_thread::get_id()) {
+		// The worker released the last database reference and is tearing the catalog down itself.
+		worker.detach();
+	} else {
+		worker.join();
+	}
+}
+
+void OracleMirrorManager::RefreshLoop() {
+	std::unique_lock<std::mutex> guard(lock);
+	while (!stopped) {
+		auto now = std::chrono::steady_clock::now();
+		auto wake = now + std::chrono::seconds(settings.mirror_refresh_interval);
+		vector<shared_ptr<MirrorEntry>> due;
+		for (auto &entry : entries) {
+			if (entry.second->next_refresh <= now) {
+				due.push_back(entry.second);
+			} else if (entry.second->next_refresh < wake) {
+				wake = entry.second->next_refresh;
+			}
+		}
+		if (due.empty()) {
+			cv.wait_until(guard, wake);
+			continue;
+		}
+		guard.unlock();
+		for (auto &entry : due) {
+			{
+				auto db = database.lock();
+				if (!db) {
+					guard.lock();
+					stopped = true;
+					return;
+				}
+				try {
+					Refresh(*db, *entry);
+				} catch (std::exception &ex) {
+					if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+						fprintf(stderr, "[oracle] mirror refresh of %s.%s failed: %s\n",
+						        entry->definition.schema_name.c_str(), entry->definition.table_name.c_str(),
+						        ex.what());
+					}
+				}
+				// Releasing db may destroy the database (and call Stop() on this thread); nothing below touches it.
+			}
+			std::lock_guard<std::mutex> entry_guard(lock);
+			auto interval = std::chrono::seconds(settings.mirror_refresh_interval);
+			entry->next_refresh = std::chrono::steady_clock::now() + interval;
+			if (stopped) {
+				break;
+			}
+		}
+		guard.lock();
+	}
+}
+
+shared_ptr<ColumnDataCollection> OracleMirrorManager::Fetch(DatabaseInstance &db,
+                                                            const OracleMirrorDefinition &definition,
+                                                            const string &oracle_query) {
+	// Read through oracle_query so mirrors share type mapping with live scans, then pin the catalog types.
+	string select_list;
+	for (idx_t i = 0; i < definition.names.size(); i++) {
+		if (i > 0) {
+			select_list += ", ";
+		}
+		auto quoted = KeywordHelper::WriteQuoted(definition.names[i], '"');
+		select_list += StringUtil::Format("CAST(%s AS %s) AS %s", quoted.c_str(),
+		                                  definition.types[i].ToString().c_str(), quoted.c_str());
+	}
+	auto sql = StringUtil::Format("SELECT %s FROM oracle_query(%s, %s)", select_list.c_str(),
+	                              Value(connection_string).ToSQLString().c_str(),
+	                              Value(oracle_query).ToSQLString().c_str());
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] mirror query: %s\n", oracle_query.c_str());
+	}
+	Connection con(db);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if (stopped) {
+			throw InterruptException();
+		}
+		active_context = con.context;
+	}
+	auto result = con.Query(sql);
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		active_context.reset();
+	}
+	if (result->HasError()) {
+		result->ThrowError();
+	}
+	return shared_ptr<ColumnDataCollection>(result->TakeCollection().release());
+}
+
+void OracleMirrorManager::Refresh(DatabaseInstance &db, MirrorEntry &entry) {
+	auto &definition = entry.definition;
+	auto qualified_table = KeywordHelper::WriteQuoted(definition.schema_name, '"') + "." +
+	                       KeywordHelper::WriteQuoted(definition.table_name, '"');
+	auto base_query = StringUtil::Format("SELECT %s FROM %s", definition.select_list.c_str(), qualified_table.c_str());
+
+	OracleConnection conn;
+	conn.Connect(connection_string, settings);
+	if (!entry.keys_loaded) {
+		entry.key_columns = LoadPrimaryKey(conn, definition);
+		entry.keys_loaded = true;
+	}
+
+	// Capture the high-water SCN before reading so that concurrent commits are picked up by the next delta.
+	auto started = std::chrono::steady_clock::now();
+	auto high_water_scn = conn.GetCurrentScn();
+
+	shared_ptr<OracleMirrorSnapshot> current;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		current = entry.snapshot;
+	}
+
+	shared_ptr<ColumnDataCollection> data;
+	if (current) {
+		// Changed and total rows in one pass over the table.
+		auto counts = conn.Query(StringUtil::Format(
+		    "SELECT COUNT(CASE WHEN ORA_ROWSCN > %lld THEN 1 END), COUNT(*) FROM %s", current->scn,
+		    qualified_table.c_str()));
+		auto changed_rows = counts.GetInt64(0, 0);
+		auto remote_rows = static_cast<idx_t>(counts.GetInt64(0, 1));
+		if (changed_rows == 0 && remote_rows == current->data->Count()) {
+			data = current->data;
+		} else if (!entry.key_columns.empty()) {
+			auto delta = Fetch(db, definition,
+			                   StringUtil::Format("%s WHERE ORA_ROWSCN > %lld", base_query.c_str(), current->scn));
+			data = MergeByKey(*current->data, *delta, entry.key_columns);
+			if (data->Count() != remote_rows) {
+				// Deletes leave no ORA_ROWSCN trace; reload to converge.
+				data.reset();
+			}
+		}
+	}
+	if (!data) {
+		data = Fetch(db, definition, base_query);
+	}
+
+	auto snapshot = make_shared_ptr<OracleMirrorSnapshot>();
+	snapshot->data = std::move(data);
+	snapshot->scn = high_water_scn;
+	snapshot->refreshed_at = started;
+	if (settings.debug_show_queries || getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] mirror %s refreshed: %llu rows at SCN %lld\n", qualified_table.c_str(),
+		        static_cast<unsigned long long>(snapshot->data->Count()), static_cast<long long>(high_water_scn));
+	}
+	std::lock_guard<std::mutex> guard(lock);
+	entry.snapshot = std::move(snapshot);
+}
+
+} // namespace duckdb
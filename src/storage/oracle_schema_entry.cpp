@@ -11,7 +11,9 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/catalog/entry_lookup_info.hpp"
 #include "oracle_catalog_state.hpp"
+#include <algorithm>
 #include <memory>
 #include "oracle_table_entry.hpp"
 
@@ -25,7 +27,22 @@ public:
 	OracleSchemaEntry(Catalog &catalog, CreateSchemaInfo &info, shared_ptr<OracleCatalogState> state,
 	                  string oracle_schema_p = "");
 
+	optional_ptr<CatalogEntry> LookupEntry(CatalogTransaction transaction, const EntryLookupInfo &lookup_info) override;
+
 	string oracle_schema;
+
+private:
+	//! Entry to bind for a table entry: the entry itself, or a reload when DDL changed the catalog version since its
+	//! columns were loaded. nullptr when the object no longer exists.
+	optional_ptr<CatalogEntry> CurrentEntry(OracleTableEntry &entry);
+
+	shared_ptr<OracleCatalogState> state;
+	std::mutex refresh_lock;
+	//! Reloaded table entries by entry name; they shadow the entries the generator placed in the table set.
+	unordered_map<string, unique_ptr<OracleTableEntry>> refreshed_entries;
+	//! Superseded reloads with the catalog version they were retired at, kept alive for statements that bound them.
+	//! Prepared statements rebind once the version moves on, so only entries retired at the current version are kept.
+	vector<pair<idx_t, unique_ptr<OracleTableEntry>>> retired_entries;
 };
 
 class OracleTableGenerator : public DefaultGenerator {
@@ -36,6 +53,10 @@ public:
 
 	vector<string> GetDefaultEntries() override {
 		auto &ora_schema = schema.Cast<OracleSchemaEntry>();
+		// Enumeration creates an entry per object; load all their columns up front in one query.
+		if (state->settings.metadata_prefetch) {
+			state->PrefetchSchema(ora_schema.oracle_schema);
+		}
 		// Use ListObjects with metadata_object_types setting
 		return state->ListObjects(ora_schema.oracle_schema, state->settings.metadata_object_types);
 	}
@@ -67,7 +88,7 @@ private:
 
 OracleSchemaEntry::OracleSchemaEntry(Catalog &catalog, CreateSchemaInfo &info, shared_ptr<OracleCatalogState> state,
                                      string oracle_schema_p)
-    : DuckSchemaEntry(catalog, info), oracle_schema(std::move(oracle_schema_p)) {
+    : DuckSchemaEntry(catalog, info), oracle_schema(std::move(oracle_schema_p)), state(state) {
 	if (oracle_schema.empty()) {
 		oracle_schema = info.schema;
 	}
@@ -75,6 +96,53 @@ OracleSchemaEntry::OracleSchemaEntry(Catalog &catalog, CreateSchemaInfo &info, s
 	table_set.SetDefaultGenerator(make_uniq<OracleTableGenerator>(catalog, *this, std::move(state)));
 }
 
+optional_ptr<CatalogEntry> OracleSchemaEntry::LookupEntry(CatalogTransaction transaction,
+                                                          const EntryLookupInfo &lookup_info) {
+	auto entry = DuckSchemaEntry::LookupEntry(transaction, lookup_info);
+	if (!entry || entry->type != CatalogType::TABLE_ENTRY) {
+		return entry;
+	}
+	auto table = dynamic_cast<OracleTableEntry *>(entry.get());
+	if (!table) {
+		return entry;
+	}
+	// Polls for DDL when ddl_check_interval has passed, so ad-hoc queries see it as well as prepared ones.
+	state->GetCatalogVersion();
+	if (!table->IsStale()) {
+		return entry;
+	}
+	return CurrentEntry(*table);
+}
+
+optional_ptr<CatalogEntry> OracleSchemaEntry::CurrentEntry(OracleTableEntry &entry) {
+	// Generated entries are committed to the table set and cannot be replaced there, so reloads shadow them here.
+	{
+		lock_guard<std::mutex> guard(refresh_lock);
+		auto refreshed = refreshed_entries.find(entry.name);
+		if (refreshed != refreshed_entries.end() && !refreshed->second->IsStale()) {
+			return refreshed->second.get();
+		}
+	}
+	auto reloaded =
+	    OracleTableEntry::Create(catalog, *this, entry.OracleSchemaName(), entry.OracleTableName(), state, entry.name);
+	if (reloaded->GetColumns().LogicalColumnCount() == 0) {
+		return nullptr; // dropped since the entry was generated
+	}
+	lock_guard<std::mutex> guard(refresh_lock);
+	auto version = state->CurrentCatalogVersion();
+	retired_entries.erase(std::remove_if(retired_entries.begin(), retired_entries.end(),
+	                                     [&](const pair<idx_t, unique_ptr<OracleTableEntry>> &retired) {
+		                                     return retired.first < version;
+	                                     }),
+	                      retired_entries.end());
+	auto &slot = refreshed_entries[entry.name];
+	if (slot) {
+		retired_entries.emplace_back(version, std::move(slot));
+	}
+	slot = std::move(reloaded);
+	return slot.get();
+}
+
 class OracleSchemaGenerator : public DefaultGenerator {
 public:
 	OracleSchemaGenerator(Catalog &catalog, shared_ptr<OracleCatalogState> state)
@@ -128,6 +196,14 @@ public:
 	    : DuckCatalog(db), state(std::move(state)) {
 	}
 
+	~OracleCatalog() override {
+		// DETACH: persist what this catalog learned (the state may outlive it in the storage extension).
+		try {
+			state->SaveMetadataCache();
+		} catch (std::exception &) {
+		}
+	}
+
 	string GetCatalogType() override {
 		return "oracle";
 	}
@@ -137,7 +213,7 @@ public:
 	}
 
 	optional_idx GetCatalogVersion(ClientContext &context) override {
-		return optional_idx();
+		return optional_idx(state->GetCatalogVersion());
 	}
 
 	void Initialize(bool load_builtin) override {
@@ -147,6 +223,11 @@ public:
 		// Detect current schema and Oracle version after successful connection
 		state->DetectCurrentSchema();
 		state->DetectOracleVersion();
+		state->ResetObjectCaches();
+		state->LoadMetadataCache();
+		if (state->settings.metadata_prefetch) {
+			state->PrefetchSchema(state->GetCurrentSchema());
+		}
 
 		GetSchemaCatalogSet().SetDefaultGenerator(make_uniq<OracleSchemaGenerator>(*this, state));
 	}
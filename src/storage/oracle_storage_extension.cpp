@@ -7,6 +7,7 @@
 #include "oracle_storage_extension.hpp"
 #include "oracle_transaction_manager.hpp"
 #include "oracle_secret.hpp"
+#include "oracle_connection_manager.hpp"
 
 namespace duckdb {
 
@@ -61,6 +62,7 @@ static unique_ptr<Catalog> OracleAttach(optional_ptr<StorageExtensionInfo> stora
 
 		// Build connection string from secret parameters
 		connection_string = BuildConnectionStringFromSecret(*kv_secret);
+		ApplyOracleSecretOptions(*kv_secret, options.options);
 	}
 
 	// Use in-memory storage underneath the DuckDB catalog
@@ -79,6 +81,15 @@ static unique_ptr<Catalog> OracleAttach(optional_ptr<StorageExtensionInfo> stora
 	}
 	// Map attach options to state settings (best-effort, ignore unknown keys).
 	state->ApplyOptions(options.options);
+	// Log on min_connections sessions concurrently so the first parallel scan does not pay serial logons.
+	auto warm_settings = state->settings;
+	Value min_connections;
+	if (context.TryGetCurrentSetting("oracle_min_connections", min_connections)) {
+		warm_settings.min_connections =
+		    MaxValue<idx_t>(warm_settings.min_connections, static_cast<idx_t>(min_connections.GetValue<int64_t>()));
+	}
+	OracleConnectionManager::Instance().WarmUp(state->connection_string, warm_settings);
+	state->StartMirrors(db.GetDatabase());
 	return CreateOracleCatalog(db, state);
 }
 
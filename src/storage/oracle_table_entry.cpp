@@ -1,6 +1,7 @@
 #include "oracle_table_entry.hpp"
 #include "oracle_table_function.hpp"
 #include "oracle_transaction.hpp"
+#include "oracle_mirror.hpp"
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -68,6 +69,44 @@ static string GetConversionExpression(const string &quoted_col, const OracleColu
 	}
 }
 
+//! OCI type and column size an OCI describe would report for a select-list item, derived from catalog metadata.
+static void DescribeFromMetadata(const OracleColumnMetadata &meta, bool rewritten, ub2 &oci_type, ub4 &oci_size) {
+	// Sizes follow the describe path: 0 (numbers, dates, LOBs, CLOB results) falls back to 4000 there too.
+	oci_type = SQLT_CHR;
+	oci_size = 4000;
+	if (rewritten) {
+		if (meta.category == OracleTypeCategory::JSON) {
+			oci_size = 32767; // JSON_SERIALIZE ... RETURNING VARCHAR2(32767)
+		} else if (meta.category == OracleTypeCategory::RAW && meta.data_length > 0) {
+			oci_size = static_cast<ub4>(meta.data_length * 2); // RAWTOHEX
+		}
+		return;
+	}
+	switch (meta.category) {
+	case OracleTypeCategory::LOB_BLOB:
+		oci_type = SQLT_BLOB;
+		break;
+	case OracleTypeCategory::LOB_CLOB:
+		oci_type = SQLT_CLOB;
+		break;
+	case OracleTypeCategory::RAW:
+		oci_type = SQLT_BIN;
+		oci_size = meta.data_length > 0 ? static_cast<ub4>(meta.data_length) : 4000;
+		break;
+	case OracleTypeCategory::STANDARD:
+		oci_size = meta.data_length > 0 ? static_cast<ub4>(meta.data_length) : 4000;
+		break;
+	case OracleTypeCategory::NUMERIC:
+		oci_type = SQLT_NUM;
+		break;
+	case OracleTypeCategory::TEMPORAL:
+		oci_type = SQLT_TIMESTAMP;
+		break;
+	default:
+		break;
+	}
+}
+
 static LogicalType MapOracleColumn(const string &data_type, idx_t precision, idx_t scale, idx_t char_len,
                                    const OracleSettings &settings) {
 	auto upper = StringUtil::Upper(data_type);
@@ -131,38 +170,14 @@ static LogicalType MapOracleColumn(const string &data_type, idx_t precision, idx
 
 static void LoadColumns(OracleCatalogState &state, const string &schema, const string &table,
                         vector<ColumnDefinition> &columns, vector<OracleColumnMetadata> &metadata) {
-	auto query = StringUtil::Format("SELECT column_name, data_type, data_length, data_precision, data_scale, nullable "
-	                                "FROM all_tab_columns WHERE owner = UPPER(%s) AND table_name = UPPER(%s) "
-	                                "ORDER BY column_id",
-	                                Value(schema).ToSQLString().c_str(), Value(table).ToSQLString().c_str());
-	auto result = state.Query(query);
-	for (auto &row : result.rows) {
-		if (row.size() < 6) {
-			continue;
-		}
-		auto col_name = row[0];
-		auto data_type = row[1];
-		auto parse_idx = [](const string &s) -> idx_t {
-			if (s.empty()) {
-				return 0;
-			}
-			try {
-				return static_cast<idx_t>(std::stoll(s));
-			} catch (...) {
-				return 0;
-			}
-		};
-		idx_t data_len = parse_idx(row[2]);
-		idx_t precision = parse_idx(row[3]);
-		idx_t scale = parse_idx(row[4]);
-		auto nullable = row[5] == "Y";
-
-		auto logical = MapOracleColumn(data_type, precision, scale, data_len, state.settings);
-		ColumnDefinition col_def(col_name, logical);
+	for (auto &column : state.GetColumns(schema, table)) {
+		auto logical =
+		    MapOracleColumn(column.data_type, column.precision, column.scale, column.data_length, state.settings);
+		ColumnDefinition col_def(column.name, logical);
 		columns.push_back(std::move(col_def));
 
 		// Store original Oracle type metadata
-		metadata.emplace_back(col_name, data_type);
+		metadata.emplace_back(column.name, column.data_type, column.data_length);
 	}
 }
 
@@ -183,13 +198,16 @@ unique_ptr<OracleTableEntry> OracleTableEntry::Create(Catalog &catalog, SchemaCa
 	info->table = duckdb_entry_name.empty() ? table_name : duckdb_entry_name;
 	vector<ColumnDefinition> cols;
 	vector<OracleColumnMetadata> metadata;
+	auto catalog_version = state->CurrentCatalogVersion();
 	LoadColumns(*state, schema_name, table_name, cols, metadata);
 	for (auto &col : cols) {
 		info->columns.AddColumn(col.Copy());
 	}
 	info->on_conflict = OnCreateConflict::IGNORE_ON_CONFLICT;
-	return make_uniq<OracleTableEntry>(catalog, schema, std::move(info), std::move(state), schema_name, table_name,
-	                                   std::move(metadata));
+	auto result = make_uniq<OracleTableEntry>(catalog, schema, std::move(info), std::move(state), schema_name,
+	                                          table_name, std::move(metadata));
+	result->catalog_version = catalog_version;
+	return result;
 }
 
 TableFunction OracleTableEntry::GetScanFunction(ClientContext &context, unique_ptr<FunctionData> &bind_data) {
@@ -212,6 +230,11 @@ TableFunction OracleTableEntry::GetScanFunction(ClientContext &context, unique_p
 	// Controlled by enable_type_conversion setting
 	string column_list;
 	idx_t col_idx = 0;
+	// Define info derived from metadata, so the bind needs no describe round trip
+	vector<LogicalType> define_types;
+	vector<ub2> oci_types;
+	vector<ub4> oci_sizes;
+	bool metadata_complete = column_metadata.size() == return_types.size();
 	for (auto &col : columns.Physical()) {
 		if (col_idx > 0) {
 			column_list += ", ";
@@ -220,27 +243,69 @@ TableFunction OracleTableEntry::GetScanFunction(ClientContext &context, unique_p
 		auto quoted_col = KeywordHelper::WriteQuoted(col.Name(), '"');
 
 		// Apply type-specific conversion if enabled and needed
+		bool rewritten = false;
 		if (settings.enable_type_conversion && col_idx < column_metadata.size()) {
 			const auto &meta = column_metadata[col_idx];
 			if (meta.RequiresQueryRewrite(version_info, settings.try_native_lobs)) {
 				// Generate conversion expression and alias
 				auto converted = GetConversionExpression(quoted_col, meta, version_info);
 				column_list += StringUtil::Format("%s AS %s", converted.c_str(), quoted_col.c_str());
+				rewritten = true;
 			} else {
 				column_list += quoted_col;
 			}
 		} else {
 			column_list += quoted_col;
 		}
+		if (metadata_complete) {
+			ub2 oci_type;
+			ub4 oci_size;
+			DescribeFromMetadata(column_metadata[col_idx], rewritten, oci_type, oci_size);
+			oci_types.push_back(oci_type);
+			oci_sizes.push_back(oci_size);
+			// Conversion expressions return text; fetch them as strings whatever the catalog type is.
+			define_types.push_back(rewritten ? LogicalType::VARCHAR : col.Type());
+		}
 		col_idx++;
 	}
 
+	// Mirrored tables are served from the local copy while it is fresh enough; otherwise scan Oracle live.
+	auto mirrors = state->GetMirrors();
+	if (mirrors && mirrors->IsMirrored(schema_name, table_name)) {
+		OracleMirrorDefinition definition;
+		definition.schema_name = schema_name;
+		definition.table_name = table_name;
+		definition.select_list = column_list;
+		definition.names = names;
+		definition.types = return_types;
+		mirrors->Register(std::move(definition));
+		auto snapshot = mirrors->GetFreshSnapshot(schema_name, table_name);
+		if (snapshot) {
+			auto tf = OracleMirrorScanFunction(std::move(snapshot), bind_data);
+			tf.name = table_name;
+			return tf;
+		}
+	}
+
 	auto query =
 	    StringUtil::Format("SELECT %s FROM %s.%s", column_list.c_str(), quoted_schema.c_str(), quoted_table.c_str());
 
 	auto bind = make_uniq<OracleBindData>();
-	bind_data =
-	    OracleBindInternal(context, state->connection_string, query, return_types, names, bind.release(), state.get());
+	if (metadata_complete) {
+		bind_data = OracleBindDescribed(context, state->connection_string, query, names, define_types, oci_types,
+		                                oci_sizes, bind.release(), state.get());
+	} else {
+		bind_data = OracleBindInternal(context, state->connection_string, query, return_types, names, bind.release(),
+		                               state.get());
+	}
+	auto &oracle_bind = bind_data->Cast<OracleBindData>();
+	if (oracle_bind.settings.enable_statistics || oracle_bind.settings.point_lookup) {
+		auto stats = state->GetTableStatistics(schema_name, table_name);
+		if (oracle_bind.settings.enable_statistics) {
+			oracle_bind.table_stats = stats;
+		}
+		oracle_bind.unique_keys = stats->unique_keys;
+	}
 
 	TableFunction tf({}, OracleQueryFunction, nullptr, OracleInitGlobal, nullptr);
 	// We don't implement table_filters, so set filter_pushdown = false
@@ -249,17 +314,50 @@ TableFunction OracleTableEntry::GetScanFunction(ClientContext &context, unique_p
 	tf.filter_pushdown = false;
 	tf.pushdown_complex_filter = OraclePushdownComplexFilter;
 	tf.projection_pushdown = true;
+	tf.cardinality = OracleScanCardinality;
+	tf.statistics = OracleScanStatistics;
 	tf.name = table_name;
 	return tf;
 }
 
-TableStorageInfo OracleTableEntry::GetStorageInfo(ClientContext &) {
+//! oracle_enable_statistics of the client, which overrides the enable_statistics ATTACH option.
+static bool StatisticsEnabled(ClientContext &context, const OracleCatalogState &state) {
+	Value option_value;
+	if (context.TryGetCurrentSetting("oracle_enable_statistics", option_value)) {
+		return option_value.GetValue<bool>();
+	}
+	return state.settings.enable_statistics;
+}
+
+TableStorageInfo OracleTableEntry::GetStorageInfo(ClientContext &context) {
 	TableStorageInfo info;
+	if (!StatisticsEnabled(context, *state)) {
+		return info;
+	}
+	auto stats = state->GetTableStatistics(schema_name, table_name);
+	if (stats && stats->has_row_count) {
+		info.cardinality = stats->num_rows;
+	}
 	return info;
 }
 
-unique_ptr<BaseStatistics> OracleTableEntry::GetStatistics(ClientContext &, column_t) {
-	return nullptr;
+unique_ptr<BaseStatistics> OracleTableEntry::GetStatistics(ClientContext &context, column_t column_id) {
+	if (!StatisticsEnabled(context, *state)) {
+		return nullptr;
+	}
+	auto stats = state->GetTableStatistics(schema_name, table_name);
+	if (!stats || column_id >= columns.LogicalColumnCount()) {
+		return nullptr;
+	}
+	auto &column = columns.GetColumn(LogicalIndex(column_id));
+	auto entry = stats->columns.find(column.Name());
+	if (entry == stats->columns.end()) {
+		return nullptr;
+	}
+	// Distinct counts only; see OracleScanStatistics for why dictionary bounds are not exposed.
+	auto result = BaseStatistics::CreateUnknown(column.Type());
+	result.SetDistinctCount(entry->second.num_distinct);
+	return result.ToUnique();
 }
 
 } // namespace duckdb
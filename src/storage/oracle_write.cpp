@@ -1,10 +1,16 @@
 #include "oracle_write.hpp"
 #include "oracle_connection_manager.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/parser/keyword_helper.hpp"
 #include "oracle_connection.hpp" // For OracleConnection wrapper
 #include <cstring>
+#include <random>
 #include <unordered_map>
 
 namespace duckdb {
@@ -25,6 +31,63 @@ static void CheckOCIError(sword status, OCIError *errhp, const std::string &msg)
 
 //--- Bind Data ---
 
+idx_t OracleWriteBindSize(OracleWriteBindKind kind) {
+	switch (kind) {
+	case OracleWriteBindKind::INT64:
+	case OracleWriteBindKind::BOOLEAN:
+		return sizeof(int64_t);
+	case OracleWriteBindKind::DOUBLE:
+		return sizeof(double);
+	case OracleWriteBindKind::NUMBER:
+		return sizeof(OCINumber);
+	case OracleWriteBindKind::DATE:
+		return 7;
+	case OracleWriteBindKind::TIMESTAMP:
+		return sizeof(OCIDateTime *);
+	default:
+		return 0;
+	}
+}
+
+//! Native binds are used when the Oracle column type is known to accept the OCI type; otherwise values go as text.
+static OracleWriteBindKind ChooseBindKind(const LogicalType &type, const string &oracle_type) {
+	auto target = StringUtil::Upper(oracle_type);
+	bool numeric = target == "NUMBER" || target == "FLOAT" || target == "INTEGER" || target == "BINARY_DOUBLE" ||
+	               target == "BINARY_FLOAT";
+	bool date = target == "DATE";
+	bool timestamp = target.find("TIMESTAMP") != string::npos && target.find("TIME ZONE") == string::npos;
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+		return numeric ? OracleWriteBindKind::INT64 : OracleWriteBindKind::TEXT;
+	case LogicalTypeId::FLOAT:
+		// Widened to double, 0.1f would be stored in a NUMBER as 0.100000001490116; only binary floating-point
+		// columns take it natively, decimal ones get its shortest text form.
+		return target == "BINARY_FLOAT" || target == "BINARY_DOUBLE" ? OracleWriteBindKind::DOUBLE
+		                                                               : OracleWriteBindKind::TEXT;
+	case LogicalTypeId::DOUBLE:
+		return numeric ? OracleWriteBindKind::DOUBLE : OracleWriteBindKind::TEXT;
+	case LogicalTypeId::DECIMAL:
+		return numeric && DecimalType::GetWidth(type) <= 18 ? OracleWriteBindKind::NUMBER : OracleWriteBindKind::TEXT;
+	case LogicalTypeId::BOOLEAN:
+		return numeric || target == "BOOLEAN" ? OracleWriteBindKind::BOOLEAN : OracleWriteBindKind::TEXT;
+	case LogicalTypeId::DATE:
+		return date || timestamp ? OracleWriteBindKind::DATE : OracleWriteBindKind::TEXT;
+	case LogicalTypeId::TIMESTAMP:
+		if (date) {
+			return OracleWriteBindKind::DATE;
+		}
+		return timestamp ? OracleWriteBindKind::TIMESTAMP : OracleWriteBindKind::TEXT;
+	default:
+		return OracleWriteBindKind::TEXT;
+	}
+}
+
 unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBindInput &input,
                                          const vector<string> &names, const vector<LogicalType> &sql_types) {
 	auto result = make_uniq<OracleWriteBindData>();
@@ -33,12 +96,99 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 	string target_table = input.info.file_path;
 
 	auto &options = input.info.options;
+	bool reject_limit_set = false;
 	for (auto &op : options) {
 		string key = StringUtil::Lower(op.first);
-		if (key != "connection_string" && key != "table") {
+		if (key == "method") {
+			auto method = op.second.empty() ? string() : StringUtil::Lower(op.second.front().ToString());
+			if (method != "insert" && method != "direct_path") {
+				throw BinderException("Oracle COPY METHOD must be 'insert' or 'direct_path'");
+			}
+			result->direct_path = method == "direct_path";
+		} else if (key == "nologging") {
+			result->nologging =
+			    op.second.empty() || BooleanValue::Get(op.second.front().DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (key == "parallel") {
+			auto streams =
+			    op.second.empty() ? 0 : op.second.front().DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+			if (streams < 1) {
+				throw BinderException("Oracle COPY PARALLEL must be a positive number of direct-path streams");
+			}
+			result->parallel = static_cast<idx_t>(streams);
+		} else if (key == "writers") {
+			auto writers =
+			    op.second.empty() ? 0 : op.second.front().DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+			if (writers < 1) {
+				throw BinderException("Oracle COPY WRITERS must be a positive number of sessions");
+			}
+			result->writers = static_cast<idx_t>(writers);
+		} else if (key == "reject_limit") {
+			auto limit = op.second.empty() ? string() : op.second.front().ToString();
+			if (StringUtil::Upper(limit) == "UNLIMITED") {
+				result->reject_limit = NumericLimits<idx_t>::Maximum();
+			} else {
+				auto rows =
+				    op.second.empty() ? -1 : op.second.front().DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+				if (rows < 0) {
+					throw BinderException("Oracle COPY REJECT_LIMIT must be a row count or 'UNLIMITED'");
+				}
+				result->reject_limit = static_cast<idx_t>(rows);
+			}
+			reject_limit_set = true;
+		} else if (key == "reject_table") {
+			result->reject_table = op.second.empty() ? string() : op.second.front().ToString();
+			for (auto c : result->reject_table) {
+				if (!StringUtil::CharacterIsAlphaNumeric(c) && c != '_' && c != '$' && c != '#' && c != '.') {
+					throw BinderException("Oracle COPY REJECT_TABLE must be a plain [schema.]table name");
+				}
+			}
+		} else if (key == "staging") {
+			result->staging =
+			    op.second.empty() || BooleanValue::Get(op.second.front().DefaultCastAs(LogicalType::BOOLEAN));
+		} else if (key != "connection_string" && key != "table") {
 			throw BinderException("Unrecognized option for Oracle COPY: %s", op.first);
 		}
 	}
+	if (!result->direct_path && (result->nologging || result->parallel > 1)) {
+		throw BinderException("Oracle COPY NOLOGGING and PARALLEL require METHOD 'direct_path'");
+	}
+	if (!result->reject_table.empty() && !reject_limit_set) {
+		result->reject_limit = NumericLimits<idx_t>::Maximum();
+	}
+	if (!result->reject_table.empty() && result->reject_limit == 0) {
+		throw BinderException("Oracle COPY REJECT_TABLE needs a REJECT_LIMIT above 0; with REJECT_LIMIT 0 the first "
+		                      "rejected row fails the COPY and nothing is recorded");
+	}
+	if (result->direct_path && (result->reject_limit > 0 || !result->reject_table.empty())) {
+		throw BinderException("Oracle COPY REJECT_LIMIT and REJECT_TABLE require METHOD 'insert'");
+	}
+	// A staging table lacks the target's constraints, so with a reject limit rows go to the target directly and every
+	// writer commits its own. That gives up the all-or-nothing COPY, so it takes an explicit STAGING false.
+	if (result->writers > 1 && result->reject_limit > 0 && result->staging) {
+		throw BinderException("Oracle COPY REJECT_LIMIT and REJECT_TABLE with WRITERS > 1 cannot use a staging table, "
+		                      "so each writer commits its own rows; add STAGING false to accept a non-atomic COPY");
+	}
+	if (result->direct_path && result->writers > 1) {
+		throw BinderException("Oracle COPY WRITERS applies to METHOD 'insert'; use PARALLEL for direct-path streams");
+	}
+	result->settings = GetOracleSettings(context);
+	// Every stream or writer, the COPY session included, holds a bulk session of its own; asking for more than the
+	// pool admits would only wait for the acquire timeout.
+	auto bulk_limit = OracleConnectionManager::BulkSessionLimit(result->settings);
+	if (result->parallel > bulk_limit) {
+		throw BinderException("Oracle COPY PARALLEL %d needs %d bulk sessions, but oracle_connection_limit %d admits "
+		                      "%d; raise oracle_connection_limit",
+		                      static_cast<int64_t>(result->parallel), static_cast<int64_t>(result->parallel),
+		                      static_cast<int64_t>(result->settings.connection_limit),
+		                      static_cast<int64_t>(bulk_limit));
+	}
+	if (result->writers > bulk_limit) {
+		throw BinderException("Oracle COPY WRITERS %d needs %d bulk sessions, but oracle_connection_limit %d admits "
+		                      "%d; raise oracle_connection_limit",
+		                      static_cast<int64_t>(result->writers), static_cast<int64_t>(result->writers),
+		                      static_cast<int64_t>(result->settings.connection_limit),
+		                      static_cast<int64_t>(bulk_limit));
+	}
 
 	auto conn_it = options.find("connection_string");
 	if (conn_it == options.end()) {
@@ -89,14 +239,16 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 	result->column_names = names;
 	result->column_types = sql_types;
 	result->oracle_types.resize(names.size(), "VARCHAR2"); // Default
+	result->oracle_lengths.resize(names.size(), 0);         // Unknown
 
+	// Indexes and enabled key constraints on the target (PARALLEL direct path only)
+	idx_t key_structures = 0;
 	// Introspect Oracle table to get actual types
 	if (!result->connection_string.empty()) {
 		try {
-			OracleSettings settings;
 			// Use temporary connection logic to avoid catalog state dependency if simple string
 			OracleConnection temp_conn;
-			temp_conn.Connect(result->connection_string);
+			temp_conn.Connect(result->connection_string, result->settings);
 
 			// Try to find table metadata
 			string schema_filter = result->schema_name.empty() ? "owner = SYS_CONTEXT('USERENV', 'CURRENT_SCHEMA')"
@@ -106,8 +258,9 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 			string table_filter =
 			    "(table_name = '" + result->object_name + "' OR table_name = upper('" + result->object_name + "'))";
 
-			string query = "SELECT owner, table_name, column_name, data_type FROM all_tab_columns WHERE " +
-			               schema_filter + " AND " + table_filter + " ORDER BY owner, table_name, column_id";
+			string query =
+			    "SELECT owner, table_name, column_name, data_type, data_length FROM all_tab_columns WHERE " +
+			    schema_filter + " AND " + table_filter + " ORDER BY owner, table_name, column_id";
 
 			auto query_res = temp_conn.Query(query);
 
@@ -123,15 +276,14 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 
 			std::unordered_map<string, string> col_type_map; // Name -> Type
 			std::unordered_map<string, string> col_name_map; // UpperName -> ActualName
+			std::unordered_map<string, idx_t> col_length_map; // Name -> DATA_LENGTH
 
-			for (auto &row : query_res.rows) {
-				if (row.size() < 4) {
-					continue;
-				}
-				const string &owner = row[0];
-				const string &table = row[1];
-				const string &col = row[2];
-				const string &type = row[3];
+			for (idx_t row = 0; row < query_res.RowCount(); row++) {
+				auto owner = query_res.GetString(row, 0);
+				auto table = query_res.GetString(row, 1);
+				auto col = query_res.GetString(row, 2);
+				auto type = query_res.GetString(row, 3);
+				auto length = query_res.GetString(row, 4);
 
 				if (best_table_name.empty()) {
 					best_table_name = table;
@@ -144,6 +296,7 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 						best_owner = owner;
 						col_type_map.clear();
 						col_name_map.clear();
+						col_length_map.clear();
 						found_exact = true;
 					} else if (found_exact) {
 						continue;
@@ -157,6 +310,7 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 				if (table == best_table_name) {
 					col_type_map[col] = type;
 					col_name_map[StringUtil::Upper(col)] = col;
+					col_length_map[col] = length.empty() ? 0 : std::stoull(length);
 				}
 			}
 
@@ -165,6 +319,16 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 				if (result->schema_name.empty()) {
 					result->schema_name = best_owner;
 				}
+				if (result->direct_path && result->parallel > 1) {
+					auto owner_sql = Value(best_owner).ToSQLString();
+					auto table_sql = Value(best_table_name).ToSQLString();
+					auto key_res = temp_conn.Query(StringUtil::Format(
+					    "SELECT (SELECT COUNT(*) FROM all_indexes WHERE table_owner = %s AND table_name = %s) + "
+					    "(SELECT COUNT(*) FROM all_constraints WHERE owner = %s AND table_name = %s "
+					    "AND constraint_type IN ('P', 'U', 'R') AND status = 'ENABLED') FROM DUAL",
+					    owner_sql, table_sql, owner_sql, table_sql));
+					key_structures = key_res.RowCount() > 0 ? static_cast<idx_t>(key_res.GetInt64(0, 0)) : 0;
+				}
 			}
 
 			// Update result->oracle_types and column_names based on DuckDB column names
@@ -188,6 +352,7 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 					result->column_names[i] = actual_name; // Update to correct casing
 					if (col_type_map.count(actual_name)) {
 						result->oracle_types[i] = col_type_map[actual_name];
+						result->oracle_lengths[i] = col_length_map[actual_name];
 					}
 				}
 			}
@@ -199,54 +364,418 @@ unique_ptr<FunctionData> OracleWriteBind(ClientContext &context, CopyFunctionBin
 		}
 	}
 
+	for (idx_t i = 0; i < names.size(); i++) {
+		result->bind_kinds.push_back(ChooseBindKind(sql_types[i], result->oracle_types[i]));
+	}
+
+	if (key_structures > 0) {
+		// Parallel direct path streams do not maintain indexes and cannot check keys; the load would leave them
+		// unusable or violated.
+		throw BinderException("Oracle COPY PARALLEL direct path cannot load %s, which has indexes or key "
+		                      "constraints; use PARALLEL 1 or drop them for the load",
+		                      result->table_name);
+	}
+
+	if (result->direct_path) {
+		for (auto &type : result->oracle_types) {
+			auto upper = StringUtil::Upper(type);
+			if (upper == "SDO_GEOMETRY" || upper == "MDSYS.SDO_GEOMETRY" || upper == "XMLTYPE") {
+				throw BinderException(
+				    "Oracle COPY METHOD 'direct_path' does not support %s columns; use METHOD 'insert'", type);
+			}
+		}
+	}
+
 	return std::move(result);
 }
 
-//--- Global State ---
+//--- Direct Path ---
+
+//! Max bytes per value in the column array: character/numeric/date text, or raw bytes for BLOB/RAW.
+static ub4 DirectPathDataSize(const string &oracle_type) {
+	auto type = StringUtil::Upper(oracle_type);
+	if (type == "BLOB" || type == "CLOB" || type == "NCLOB" || type == "LONG" || type == "LONG RAW") {
+		return 1048576;
+	}
+	if (type == "NUMBER" || type == "FLOAT" || type == "BINARY_FLOAT" || type == "BINARY_DOUBLE" || type == "DATE" ||
+	    type.find("TIMESTAMP") != string::npos) {
+		return 128;
+	}
+	return 32767; // VARCHAR2/RAW up to MAX_STRING_SIZE = EXTENDED
+}
 
-OracleWriteGlobalState::OracleWriteGlobalState(std::shared_ptr<OracleConnectionHandle> conn, const string &query)
-    : connection(std::move(conn)), stmthp(nullptr) {
+OracleDirectPathLoader::OracleDirectPathLoader(std::shared_ptr<OracleConnectionHandle> conn,
+                                               const OracleWriteBindData &data)
+    : connection(std::move(conn)), bind_kinds(data.bind_kinds) {
 	auto ctx = connection->Get();
-	CheckOCIError(OCIHandleAlloc(ctx->envhp, reinterpret_cast<dvoid **>(&stmthp), OCI_HTYPE_STMT, 0, nullptr),
-	              ctx->errhp, "OCIHandleAlloc stmthp");
+	auto err = ctx->errhp;
+	CheckOCIError(OCIHandleAlloc(ctx->envhp, reinterpret_cast<dvoid **>(&dpctx), OCI_HTYPE_DIRPATH_CTX, 0, nullptr),
+	              err, "OCIHandleAlloc dpctx");
 
-	// Make a mutable copy of query string for OCI
-	std::vector<char> query_buffer(query.begin(), query.end());
-	query_buffer.push_back(0);
+	CheckOCIError(OCIAttrSet(dpctx, OCI_HTYPE_DIRPATH_CTX, (dvoid *)data.object_name.c_str(),
+	                         static_cast<ub4>(data.object_name.size()), OCI_ATTR_NAME, err),
+	              err, "OCIAttrSet OCI_ATTR_NAME");
+	if (!data.schema_name.empty()) {
+		CheckOCIError(OCIAttrSet(dpctx, OCI_HTYPE_DIRPATH_CTX, (dvoid *)data.schema_name.c_str(),
+		                         static_cast<ub4>(data.schema_name.size()), OCI_ATTR_SCHEMA_NAME, err),
+		              err, "OCIAttrSet OCI_ATTR_SCHEMA_NAME");
+	}
+	ub1 nolog = data.nologging ? 1 : 0;
+	OCIAttrSet(dpctx, OCI_HTYPE_DIRPATH_CTX, &nolog, 0, OCI_ATTR_DIRPATH_NOLOG, err);
+	// Several streams load the same table concurrently; Oracle then maintains no indexes, which is why bind only
+	// allows it for tables without indexes and key constraints.
+	ub1 parallel = data.parallel > 1 ? 1 : 0;
+	OCIAttrSet(dpctx, OCI_HTYPE_DIRPATH_CTX, &parallel, 0, OCI_ATTR_DIRPATH_PARALLEL, err);
+
+	ub2 num_cols = static_cast<ub2>(data.column_names.size());
+	CheckOCIError(OCIAttrSet(dpctx, OCI_HTYPE_DIRPATH_CTX, &num_cols, 0, OCI_ATTR_NUM_COLS, err), err,
+	              "OCIAttrSet OCI_ATTR_NUM_COLS");
+
+	OCIParam *col_list = nullptr;
+	CheckOCIError(OCIAttrGet(dpctx, OCI_HTYPE_DIRPATH_CTX, &col_list, 0, OCI_ATTR_LIST_COLUMNS, err), err,
+	              "OCIAttrGet OCI_ATTR_LIST_COLUMNS");
+	for (idx_t col_idx = 0; col_idx < data.column_names.size(); col_idx++) {
+		OCIParam *col = nullptr;
+		CheckOCIError(OCIParamGet(col_list, OCI_DTYPE_PARAM, err, reinterpret_cast<dvoid **>(&col), col_idx + 1), err,
+		              "OCIParamGet direct path column");
+		auto &name = data.column_names[col_idx];
+		auto type = StringUtil::Upper(data.oracle_types[col_idx]);
+		// Values arrive as text (raw bytes for BLOB/RAW) and are converted by the direct path engine.
+		ub2 data_type = (type == "BLOB" || type == "RAW" || type == "LONG RAW") ? SQLT_BIN : SQLT_CHR;
+		ub4 data_size = DirectPathDataSize(type);
+		OCIAttrSet(col, OCI_DTYPE_PARAM, (dvoid *)name.c_str(), static_cast<ub4>(name.size()), OCI_ATTR_NAME, err);
+		OCIAttrSet(col, OCI_DTYPE_PARAM, &data_type, 0, OCI_ATTR_DATA_TYPE, err);
+		OCIAttrSet(col, OCI_DTYPE_PARAM, &data_size, 0, OCI_ATTR_DATA_SIZE, err);
+		if (type == "DATE" || type.find("TIMESTAMP") != string::npos) {
+			// DuckDB's text form of DATE/TIMESTAMP values
+			string format = type == "DATE" ? "YYYY-MM-DD HH24:MI:SS" : "YYYY-MM-DD HH24:MI:SS.FF";
+			OCIAttrSet(col, OCI_DTYPE_PARAM, (dvoid *)format.c_str(), static_cast<ub4>(format.size()),
+			           OCI_ATTR_DATEFORMAT, err);
+		}
+		OCIDescriptorFree(col, OCI_DTYPE_PARAM);
+	}
 
-	CheckOCIError(OCIStmtPrepare(stmthp, ctx->errhp, reinterpret_cast<OraText *>(query_buffer.data()),
-	                             static_cast<ub4>(query.size()), OCI_NTV_SYNTAX, OCI_DEFAULT),
-	              ctx->errhp, "OCIStmtPrepare");
+	if (getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] direct path prepare: %s (nologging=%d parallel=%d)\n", data.table_name.c_str(),
+		        (int)nolog, (int)parallel);
+	}
+	CheckOCIError(OCIDirPathPrepare(dpctx, ctx->svchp, err), err, "OCIDirPathPrepare");
+	prepared = true;
+
+	CheckOCIError(
+	    OCIHandleAlloc(dpctx, reinterpret_cast<dvoid **>(&dpca), OCI_HTYPE_DIRPATH_COLUMN_ARRAY, 0, nullptr), err,
+	    "OCIHandleAlloc dpca");
+	CheckOCIError(OCIHandleAlloc(dpctx, reinterpret_cast<dvoid **>(&dpstr), OCI_HTYPE_DIRPATH_STREAM, 0, nullptr),
+	              err, "OCIHandleAlloc dpstr");
+	CheckOCIError(OCIAttrGet(dpca, OCI_HTYPE_DIRPATH_COLUMN_ARRAY, &max_rows, 0, OCI_ATTR_NUM_ROWS, err), err,
+	              "OCIAttrGet OCI_ATTR_NUM_ROWS");
+	if (max_rows == 0) {
+		throw IOException("OCI direct path column array has no rows");
+	}
 }
 
-OracleWriteGlobalState::~OracleWriteGlobalState() {
-	if (stmthp) {
-		OCIHandleFree(stmthp, OCI_HTYPE_STMT);
+OracleDirectPathLoader::~OracleDirectPathLoader() {
+	if (worker.joinable()) {
+		{
+			lock_guard<std::mutex> guard(worker_lock);
+			stopping = true;
+		}
+		worker_cv.notify_all();
+		worker.join();
+	}
+	auto ctx = connection->Get();
+	if (prepared && !finished) {
+		OCIDirPathAbort(dpctx, ctx->errhp);
+	}
+	if (dpstr) {
+		OCIHandleFree(dpstr, OCI_HTYPE_DIRPATH_STREAM);
+	}
+	if (dpca) {
+		OCIHandleFree(dpca, OCI_HTYPE_DIRPATH_COLUMN_ARRAY);
+	}
+	if (dpctx) {
+		OCIHandleFree(dpctx, OCI_HTYPE_DIRPATH_CTX);
 	}
 }
 
-unique_ptr<GlobalFunctionData> OracleWriteInitGlobal(ClientContext &context, FunctionData &bind_data,
-                                                     const string &file_path) {
-	auto &data = bind_data.Cast<OracleWriteBindData>();
+void OracleDirectPathLoader::Append(DataChunk &chunk) {
+	chunk.Flatten();
+	for (idx_t offset = 0; offset < chunk.size(); offset += max_rows) {
+		LoadRows(chunk, offset, MinValue<idx_t>(max_rows, chunk.size() - offset));
+	}
+}
 
-	// Acquire connection
-	OracleSettings settings; // Default settings
-	auto conn = OracleConnectionManager::Instance().Acquire(data.connection_string, settings);
+void OracleDirectPathLoader::LoadRows(DataChunk &chunk, idx_t offset, idx_t count) {
+	auto err = connection->Get()->errhp;
+
+	// Strings and blobs are loaded straight from the vectors; other types are formatted into the arena first and
+	// only then handed to OCI, so arena growth cannot move text OCI already points at.
+	struct Cell {
+		const char *data;
+		idx_t arena_offset;
+		ub4 size;
+		ub1 flag;
+	};
+	vector<Cell> cells(count * chunk.ColumnCount());
+	arena.clear();
+	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+		auto &col = chunk.data[col_idx];
+		auto &validity = FlatVector::Validity(col);
+		auto type_id = col.GetType().id();
+		for (idx_t row = 0; row < count; row++) {
+			auto &cell = cells[row * chunk.ColumnCount() + col_idx];
+			cell = Cell {nullptr, 0, 0, OCI_DIRPATH_COL_COMPLETE};
+			auto source_row = offset + row;
+			if (!validity.RowIsValid(source_row)) {
+				cell.flag = OCI_DIRPATH_COL_NULL;
+				continue;
+			}
+			if (type_id == LogicalTypeId::VARCHAR || type_id == LogicalTypeId::BLOB) {
+				auto &str = FlatVector::GetData<string_t>(col)[source_row];
+				cell.data = str.GetData();
+				cell.size = static_cast<ub4>(str.GetSize());
+				continue;
+			}
+			string text;
+			switch (type_id) {
+			case LogicalTypeId::BOOLEAN:
+				// NUMBER(1) flags and BOOLEAN columns take 1/0, as on the INSERT path
+				text = FlatVector::GetData<bool>(col)[source_row] ? "1" : "0";
+				break;
+			case LogicalTypeId::TIMESTAMP:
+				if (bind_kinds[col_idx] == OracleWriteBindKind::DATE) {
+					// DATE has no fractional seconds: truncate them, as the INSERT path does
+					int32_t year, month, day, hour, minute, second, micros;
+					date_t date;
+					dtime_t time;
+					Timestamp::Convert(FlatVector::GetData<timestamp_t>(col)[source_row], date, time);
+					Date::Convert(date, year, month, day);
+					Time::Convert(time, hour, minute, second, micros);
+					text = StringUtil::Format("%04d-%02d-%02d %02d:%02d:%02d", year, month, day, hour, minute, second);
+				} else {
+					text = col.GetValue(source_row).ToString();
+				}
+				break;
+			case LogicalTypeId::INTEGER:
+				text = std::to_string(FlatVector::GetData<int32_t>(col)[source_row]);
+				break;
+			case LogicalTypeId::BIGINT:
+				text = std::to_string(FlatVector::GetData<int64_t>(col)[source_row]);
+				break;
+			default:
+				text = col.GetValue(source_row).ToString();
+				break;
+			}
+			cell.arena_offset = arena.size();
+			cell.size = static_cast<ub4>(text.size());
+			arena += text;
+		}
+	}
+	for (idx_t row = 0; row < count; row++) {
+		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			auto &cell = cells[row * chunk.ColumnCount() + col_idx];
+			auto data = cell.data ? cell.data : arena.data() + cell.arena_offset;
+			CheckOCIError(OCIDirPathColArrayEntrySet(dpca, err, static_cast<ub4>(row), static_cast<ub2>(col_idx),
+			                                         (ub1 *)data, cell.size, cell.flag),
+			              err, "OCIDirPathColArrayEntrySet");
+		}
+	}
+
+	// A full stream buffer returns OCI_CONTINUE: load it and convert the remaining rows.
+	ub4 row_offset = 0;
+	while (true) {
+		auto status = OCIDirPathColArrayToStream(dpca, dpctx, dpstr, err, static_cast<ub4>(count), row_offset);
+		if (status != OCI_SUCCESS && status != OCI_CONTINUE) {
+			CheckOCIError(status == OCI_NEED_DATA ? OCI_ERROR : status, err, "OCIDirPathColArrayToStream");
+		}
+		CheckOCIError(OCIDirPathLoadStream(dpctx, dpstr, err), err, "OCIDirPathLoadStream");
+		CheckOCIError(OCIDirPathStreamReset(dpstr, err), err, "OCIDirPathStreamReset");
+		if (status == OCI_SUCCESS) {
+			break;
+		}
+		ub4 converted = 0;
+		OCIAttrGet(dpca, OCI_HTYPE_DIRPATH_COLUMN_ARRAY, &converted, 0, OCI_ATTR_ROW_COUNT, err);
+		row_offset += converted;
+	}
+	CheckOCIError(OCIDirPathColArrayReset(dpca, err), err, "OCIDirPathColArrayReset");
+}
+
+void OracleDirectPathLoader::AppendAsync(DataChunk &chunk) {
+	Wait();
+	if (pending_chunk.ColumnCount() == 0) {
+		pending_chunk.Initialize(Allocator::DefaultAllocator(), chunk.GetTypes());
+	}
+	pending_chunk.Reset();
+	chunk.Copy(pending_chunk);
+	if (!worker.joinable()) {
+		worker = std::thread([this]() { RunWorker(); });
+	}
+	{
+		lock_guard<std::mutex> guard(worker_lock);
+		has_work = true;
+	}
+	worker_cv.notify_all();
+}
+
+void OracleDirectPathLoader::RunWorker() {
+	std::unique_lock<std::mutex> guard(worker_lock);
+	while (true) {
+		worker_cv.wait(guard, [&]() { return has_work || stopping; });
+		if (!has_work) {
+			return;
+		}
+		guard.unlock();
+		std::exception_ptr error;
+		try {
+			Append(pending_chunk);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		guard.lock();
+		worker_error = error;
+		has_work = false;
+		worker_cv.notify_all();
+	}
+}
+
+void OracleDirectPathLoader::Wait() {
+	std::unique_lock<std::mutex> guard(worker_lock);
+	worker_cv.wait(guard, [&]() { return !has_work; });
+	if (worker_error) {
+		auto error = worker_error;
+		worker_error = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+void OracleDirectPathLoader::Finish() {
+	Wait();
+	auto err = connection->Get()->errhp;
+	CheckOCIError(OCIDirPathFinish(dpctx, err), err, "OCIDirPathFinish");
+	finished = true;
+}
+
+//--- Global State ---
 
-	// Generate SQL
-	string sql = "INSERT /*+ APPEND_VALUES */ INTO ";
+//! Run one statement (DDL, or the staging merge) on a session.
+static void ExecuteStatement(OracleContext &ctx, const string &sql, const string &what) {
+	if (getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] %s: %s\n", what.c_str(), sql.c_str());
+	}
+	OCIStmt *stmt = nullptr;
+	CheckOCIError(OCIHandleAlloc(ctx.envhp, reinterpret_cast<dvoid **>(&stmt), OCI_HTYPE_STMT, 0, nullptr),
+	              ctx.errhp, "OCIHandleAlloc stmthp");
+	auto status = OCIStmtPrepare(stmt, ctx.errhp, (OraText *)sql.c_str(), static_cast<ub4>(sql.size()),
+	                             OCI_NTV_SYNTAX, OCI_DEFAULT);
+	if (status == OCI_SUCCESS || status == OCI_SUCCESS_WITH_INFO) {
+		status = OCIStmtExecute(ctx.svchp, stmt, ctx.errhp, 1, 0, nullptr, nullptr, OCI_DEFAULT);
+	}
+	OCIHandleFree(stmt, OCI_HTYPE_STMT);
+	CheckOCIError(status, ctx.errhp, "Failed to " + what);
+}
+
+static string QuotedTarget(const OracleWriteBindData &data, const string &object_name) {
+	string name;
 	if (!data.schema_name.empty()) {
-		sql += KeywordHelper::WriteQuoted(data.schema_name, '"') + ".";
+		name += KeywordHelper::WriteQuoted(data.schema_name, '"') + ".";
 	}
-	sql += KeywordHelper::WriteQuoted(data.object_name, '"') + " (";
+	return name + KeywordHelper::WriteQuoted(object_name, '"');
+}
 
+static string QuotedColumnList(const OracleWriteBindData &data) {
+	string columns;
 	for (idx_t i = 0; i < data.column_names.size(); i++) {
 		if (i > 0) {
-			sql += ", ";
+			columns += ", ";
 		}
-		sql += KeywordHelper::WriteQuoted(data.column_names[i], '"');
+		columns += KeywordHelper::WriteQuoted(data.column_names[i], '"');
 	}
-	sql += ") VALUES (";
+	return columns;
+}
+
+OracleWriteGlobalState::OracleWriteGlobalState(std::shared_ptr<OracleConnectionHandle> conn, string insert_sql_p)
+    : connection(std::move(conn)), insert_sql(std::move(insert_sql_p)) {
+}
+
+OracleWriteGlobalState::~OracleWriteGlobalState() {
+	// Roll back the writers first: their open transactions lock the staging table.
+	writers.clear();
+	if (!staging_table.empty()) {
+		try {
+			ExecuteStatement(*connection->Get(), "DROP TABLE " + staging_table + " PURGE", "drop staging table");
+		} catch (std::exception &e) {
+			if (getenv("ORACLE_DEBUG")) {
+				fprintf(stderr, "[oracle] Warning: staging table %s not dropped: %s\n", staging_table.c_str(),
+				        e.what());
+			}
+		}
+	}
+}
+
+OracleWriteSession &OracleWriteGlobalState::AssignWriter(const OracleWriteBindData &data) {
+	std::unique_lock<std::mutex> guard(writer_lock);
+	auto ticket = next_writer++;
+	auto writer_idx = ticket % writers.size();
+	if (ticket >= writers.size()) {
+		// Slot taken by an earlier local state, whose session may still be opening.
+		writer_ready.wait(guard, [&]() { return writers[writer_idx] || writer_failed; });
+		if (!writers[writer_idx]) {
+			throw IOException("Oracle COPY writer %d could not open its session", static_cast<int64_t>(writer_idx));
+		}
+		return *writers[writer_idx];
+	}
+	// First use of the slot: open its session without the lock, so sinks of other writers are not held up by the
+	// pool's acquire wait.
+	guard.unlock();
+	unique_ptr<OracleWriteSession> writer;
+	try {
+		auto conn = writer_idx == 0 ? connection
+		                            : OracleConnectionManager::Instance().Acquire(data.connection_string, data.settings,
+		                                                                          OracleAcquirePriority::BULK);
+		writer = make_uniq<OracleWriteSession>(conn, insert_sql, rejects);
+	} catch (...) {
+		guard.lock();
+		writer_failed = true;
+		writer_ready.notify_all();
+		throw;
+	}
+	guard.lock();
+	writers[writer_idx] = std::move(writer);
+	writer_ready.notify_all();
+	return *writers[writer_idx];
+}
+
+unique_ptr<GlobalFunctionData> OracleWriteInitGlobal(ClientContext &context, FunctionData &bind_data,
+                                                     const string &file_path) {
+	auto &data = bind_data.Cast<OracleWriteBindData>();
+
+	// The COPY session is the first writer or stream, so it takes a bulk slot like the others.
+	auto conn =
+	    OracleConnectionManager::Instance().Acquire(data.connection_string, data.settings, OracleAcquirePriority::BULK);
+
+	if (data.direct_path) {
+		return make_uniq<OracleWriteGlobalState>(conn, string());
+	}
+
+	string staging_table;
+	if (data.writers > 1 && data.staging) {
+		// Writers commit into the staging table; the target only sees the rows once all of them made it.
+		std::random_device random;
+		char staging_name[32];
+		snprintf(staging_name, sizeof(staging_name), "DUCKDB_STG_%08X%08X", (unsigned)random(), (unsigned)random());
+		staging_table = QuotedTarget(data, staging_name);
+		ExecuteStatement(*conn->Get(),
+		                 "CREATE TABLE " + staging_table + " AS SELECT " + QuotedColumnList(data) + " FROM " +
+		                     QuotedTarget(data, data.object_name) + " WHERE 1 = 0",
+		                 "create staging table");
+	}
+
+	// Generate SQL. APPEND_VALUES takes an exclusive table lock, so it is only used by a single writer; reject
+	// handling drops it too, as OCI_BATCH_ERRORS needs a conventional insert.
+	bool append = data.writers == 1 && data.reject_limit == 0;
+	string sql = append ? "INSERT /*+ APPEND_VALUES */ INTO " : "INSERT INTO ";
+	sql += staging_table.empty() ? QuotedTarget(data, data.object_name) : staging_table;
+	sql += " (" + QuotedColumnList(data) + ") VALUES (";
 	for (idx_t i = 0; i < data.column_names.size(); i++) {
 		if (i > 0) {
 			sql += ", ";
@@ -255,7 +784,9 @@ unique_ptr<GlobalFunctionData> OracleWriteInitGlobal(ClientContext &context, Fun
 		string type = StringUtil::Upper(data.oracle_types[i]);
 		string placeholder = ":" + std::to_string(i + 1);
 
-		if (type == "DATE") {
+		if (data.bind_kinds[i] != OracleWriteBindKind::TEXT) {
+			sql += placeholder;
+		} else if (type == "DATE") {
 			sql += "TO_DATE(" + placeholder + ", 'YYYY-MM-DD HH24:MI:SS')";
 		} else if (type.find("TIMESTAMP") != string::npos) {
 			sql += "TO_TIMESTAMP(" + placeholder + ", 'YYYY-MM-DD HH24:MI:SS.FF')";
@@ -271,20 +802,71 @@ unique_ptr<GlobalFunctionData> OracleWriteInitGlobal(ClientContext &context, Fun
 		fprintf(stderr, "[oracle] Insert SQL: %s\n", sql.c_str());
 	}
 
-	return make_uniq<OracleWriteGlobalState>(conn, sql);
+	auto result = make_uniq<OracleWriteGlobalState>(conn, sql);
+	result->staging_table = staging_table;
+	result->writers.resize(data.writers);
+	result->rejects.limit = data.reject_limit;
+	if (!data.reject_table.empty()) {
+		// Created on first use; an existing table (ORA-00955) is appended to.
+		ExecuteStatement(*conn->Get(),
+		                 "BEGIN EXECUTE IMMEDIATE 'CREATE TABLE " + data.reject_table +
+		                     " (TARGET_TABLE VARCHAR2(261), ORA_ERR_NUMBER$ NUMBER, ORA_ERR_MESG$ VARCHAR2(2000), "
+		                     "ROW_DATA VARCHAR2(4000), REJECTED_AT TIMESTAMP DEFAULT SYSTIMESTAMP)'; "
+		                     "EXCEPTION WHEN OTHERS THEN IF SQLCODE != -955 THEN RAISE; END IF; END;",
+		                 "create reject table");
+		result->rejects.insert_sql = "INSERT INTO " + data.reject_table +
+		                             " (TARGET_TABLE, ORA_ERR_NUMBER$, ORA_ERR_MESG$, ROW_DATA) "
+		                             "VALUES (:1, :2, :3, :4)";
+	}
+	return std::move(result);
 }
 
-//--- Local State ---
+//--- Writer Sessions ---
+
+OracleWriteSession::OracleWriteSession(std::shared_ptr<OracleConnectionHandle> conn, const string &query,
+                                       OracleWriteRejects &rejects)
+    : connection(std::move(conn)), rejects(rejects) {
+	auto ctx = connection->Get();
+	CheckOCIError(OCIHandleAlloc(ctx->envhp, reinterpret_cast<dvoid **>(&stmthp), OCI_HTYPE_STMT, 0, nullptr),
+	              ctx->errhp, "OCIHandleAlloc stmthp");
+
+	// Make a mutable copy of query string for OCI
+	std::vector<char> query_buffer(query.begin(), query.end());
+	query_buffer.push_back(0);
 
-OracleWriteLocalState::OracleWriteLocalState(std::shared_ptr<OracleConnectionHandle> conn, OCIStmt *stmthp)
-    : connection(std::move(conn)), stmthp(stmthp) {
+	CheckOCIError(OCIStmtPrepare(stmthp, ctx->errhp, reinterpret_cast<OraText *>(query_buffer.data()),
+	                             static_cast<ub4>(query.size()), OCI_NTV_SYNTAX, OCI_DEFAULT),
+	              ctx->errhp, "OCIStmtPrepare");
 }
 
-OracleWriteLocalState::~OracleWriteLocalState() {
+OracleWriteSession::~OracleWriteSession() {
+	auto ctx = connection->Get();
+	if (pending_rows) {
+		// The COPY failed: do not hand the session back to the pool with half a load in its transaction.
+		OCITransRollback(ctx->svchp, ctx->errhp, OCI_DEFAULT);
+	}
+	for (auto &descriptors : timestamps) {
+		for (auto dt : descriptors) {
+			OCIDescriptorFree(dt, OCI_DTYPE_TIMESTAMP);
+		}
+	}
+	if (stmthp) {
+		OCIHandleFree(stmthp, OCI_HTYPE_STMT);
+	}
+	if (reject_stmthp) {
+		OCIHandleFree(reject_stmthp, OCI_HTYPE_STMT);
+	}
+	if (row_errhp) {
+		OCIHandleFree(row_errhp, OCI_HTYPE_ERROR);
+	}
 }
 
 unique_ptr<LocalFunctionData> OracleWriteInitLocal(ExecutionContext &context, FunctionData &bind_data) {
-	return make_uniq<OracleWriteLocalState>(nullptr, nullptr);
+	return make_uniq<OracleWriteLocalState>();
+}
+
+CopyFunctionExecutionMode OracleWriteExecutionMode(bool preserve_insertion_order, bool supports_batch_index) {
+	return CopyFunctionExecutionMode::PARALLEL_COPY_TO_FILE;
 }
 
 //--- Sink ---
@@ -295,60 +877,103 @@ void OracleWriteSink(ExecutionContext &context, FunctionData &bind_data, GlobalF
 	auto &lstate = lstate_p.Cast<OracleWriteLocalState>();
 	auto &data = bind_data.Cast<OracleWriteBindData>();
 
-	if (!lstate.connection) {
-		lstate = OracleWriteLocalState(gstate.connection, gstate.stmthp);
+	if (data.direct_path) {
+		lock_guard<std::mutex> guard(gstate.load_lock);
+		if (gstate.loaders.empty()) {
+			// The first stream uses the COPY session; every further stream needs a session of its own.
+			for (idx_t i = 0; i < data.parallel; i++) {
+				auto conn = i == 0 ? gstate.connection
+				                   : OracleConnectionManager::Instance().Acquire(
+				                         data.connection_string, data.settings, OracleAcquirePriority::BULK);
+				gstate.loaders.push_back(make_uniq<OracleDirectPathLoader>(conn, data));
+			}
+		}
+		if (gstate.loaders.size() == 1) {
+			gstate.loaders[0]->Append(input);
+		} else {
+			gstate.loaders[gstate.next_loader++ % gstate.loaders.size()]->AppendAsync(input);
+		}
+		return;
+	}
+
+	if (!lstate.writer) {
+		lstate.writer = &gstate.AssignWriter(data);
 	}
+	lock_guard<std::mutex> guard(lstate.writer->lock);
+	lstate.writer->Sink(input, data);
+}
 
-	lstate.Sink(input, data.oracle_types);
+//! Bind element size implied by the Oracle column definition, or 0 when the batch's values decide.
+static size_t DeclaredTextSize(const string &oracle_type, idx_t data_length) {
+	auto type = StringUtil::Upper(oracle_type);
+	if (type == "VARCHAR2" || type == "CHAR" || type == "RAW") {
+		return data_length;
+	}
+	if (type == "NVARCHAR2" || type == "NCHAR") {
+		// DATA_LENGTH counts AL16UTF16 bytes; the bind carries UTF-8
+		return data_length * 2;
+	}
+	return 0;
 }
 
-void OracleWriteLocalState::Sink(DataChunk &chunk, const vector<string> &oracle_types) {
+void OracleWriteSession::Sink(DataChunk &chunk, const OracleWriteBindData &data) {
 	idx_t count = chunk.size();
 	if (count == 0) {
 		return;
 	}
 
-	// Determine max sizes for buffer allocation
-	vector<size_t> required_sizes(chunk.ColumnCount(), 4096);
+	// Text-bound columns: strings and raw bytes are bound as they are; other types are cast to VARCHAR once per
+	// column and batch rather than through a Value and a string per cell
+	vector<Vector *> text_sources(chunk.ColumnCount(), nullptr);
+	vector<unique_ptr<Vector>> text_casts(chunk.ColumnCount());
 
+	// Element sizes: fixed for natively bound columns; for text columns the declared column length, grown to the
+	// longest value of the batch (taken from the string_t sizes, nothing is formatted twice)
+	vector<size_t> required_sizes(chunk.ColumnCount(), 0);
 	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
 		if (chunk.data[col_idx].GetVectorType() != VectorType::FLAT_VECTOR) {
 			chunk.data[col_idx].Flatten(count);
 		}
+		if (data.bind_kinds[col_idx] != OracleWriteBindKind::TEXT) {
+			required_sizes[col_idx] = OracleWriteBindSize(data.bind_kinds[col_idx]);
+			continue;
+		}
 
-		auto &validity = FlatVector::Validity(chunk.data[col_idx]);
-		size_t max_len = 0;
-
+		auto &col = chunk.data[col_idx];
+		if (col.GetType().id() == LogicalTypeId::VARCHAR || col.GetType().id() == LogicalTypeId::BLOB) {
+			text_sources[col_idx] = &col;
+		} else {
+			text_casts[col_idx] = make_uniq<Vector>(LogicalType::VARCHAR, count);
+			VectorOperations::DefaultCast(col, *text_casts[col_idx], count);
+			text_sources[col_idx] = text_casts[col_idx].get();
+		}
+		auto &strings = *text_sources[col_idx];
+		auto &validity = FlatVector::Validity(strings);
+		auto values = FlatVector::GetData<string_t>(strings);
+		size_t max_len = DeclaredTextSize(data.oracle_types[col_idx], data.oracle_lengths[col_idx]);
 		for (idx_t i = 0; i < count; i++) {
 			if (validity.RowIsValid(i)) {
-				Value val = chunk.data[col_idx].GetValue(i);
-				string s;
-				if (val.type().id() == LogicalTypeId::BLOB) {
-					s = StringValue::Get(val);
-				} else {
-					s = val.ToString();
-				}
-				if (s.size() > max_len) {
-					max_len = s.size();
-				}
+				max_len = MaxValue<size_t>(max_len, values[i].GetSize());
 			}
 		}
-
-		if (max_len > required_sizes[col_idx]) {
-			required_sizes[col_idx] = max_len + 32;
+		if (max_len > NumericLimits<ub2>::Maximum()) {
+			throw IOException("Value too large for buffer: column \"%s\" has a value of %d bytes (limit %d)",
+			                  data.column_names[col_idx], static_cast<int64_t>(max_len),
+			                  static_cast<int64_t>(NumericLimits<ub2>::Maximum()));
 		}
 		// Align
-		required_sizes[col_idx] = (required_sizes[col_idx] + 3) & ~3;
+		required_sizes[col_idx] = (MaxValue<size_t>(max_len, 1) + 3) & ~3;
 	}
 
 	// Check if rebind needed
 	bool need_rebind = false;
-	if (bind_buffers.empty()) {
-		bind_buffers.resize(chunk.ColumnCount());
+	if (bind_offsets.empty()) {
+		bind_offsets.resize(chunk.ColumnCount());
 		indicator_buffers.resize(chunk.ColumnCount());
 		length_buffers.resize(chunk.ColumnCount());
 		binds.resize(chunk.ColumnCount(), nullptr);
 		current_buffer_sizes.resize(chunk.ColumnCount(), 0);
+		timestamps.resize(chunk.ColumnCount());
 		need_rebind = true;
 	} else {
 		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
@@ -360,11 +985,16 @@ void OracleWriteLocalState::Sink(DataChunk &chunk, const vector<string> &oracle_
 	}
 
 	if (need_rebind) {
+		auto ctx = connection->Get();
+		size_t arena_size = 0;
 		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
-			if (required_sizes[col_idx] > current_buffer_sizes[col_idx]) {
-				current_buffer_sizes[col_idx] = required_sizes[col_idx];
-				bind_buffers[col_idx].resize(MAX_BATCH_SIZE * current_buffer_sizes[col_idx]);
-			}
+			current_buffer_sizes[col_idx] = MaxValue(current_buffer_sizes[col_idx], required_sizes[col_idx]);
+			bind_offsets[col_idx] = arena_size;
+			// Keep every column array 8-byte aligned for the int64/double/pointer elements
+			arena_size += (MAX_BATCH_SIZE * current_buffer_sizes[col_idx] + 7) & ~size_t(7);
+		}
+		if (arena_size > bind_arena.size()) {
+			bind_arena.resize(arena_size);
 		}
 
 		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
@@ -373,17 +1003,49 @@ void OracleWriteLocalState::Sink(DataChunk &chunk, const vector<string> &oracle_
 		}
 
 		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
-			string type = StringUtil::Upper(oracle_types[col_idx]);
+			string type = StringUtil::Upper(data.oracle_types[col_idx]);
 			ub2 bind_type = SQLT_CHR; // Use SQLT_CHR (VARCHAR2) instead of SQLT_STR for length-based binding
 
-			if (type == "BLOB" || type == "RAW") {
-				bind_type = SQLT_LBI;
-			} else if (type == "CLOB") {
-				bind_type = SQLT_LNG;
+			switch (data.bind_kinds[col_idx]) {
+			case OracleWriteBindKind::INT64:
+			case OracleWriteBindKind::BOOLEAN:
+				bind_type = SQLT_INT;
+				break;
+			case OracleWriteBindKind::DOUBLE:
+				bind_type = SQLT_BDOUBLE;
+				break;
+			case OracleWriteBindKind::NUMBER:
+				bind_type = SQLT_VNU;
+				break;
+			case OracleWriteBindKind::DATE:
+				bind_type = SQLT_DAT;
+				break;
+			case OracleWriteBindKind::TIMESTAMP: {
+				bind_type = SQLT_TIMESTAMP;
+				// The bind array holds descriptor pointers; the descriptors are filled in place for every batch.
+				auto &descriptors = timestamps[col_idx];
+				while (descriptors.size() < MAX_BATCH_SIZE) {
+					OCIDateTime *dt = nullptr;
+					CheckOCIError(OCIDescriptorAlloc(ctx->envhp, reinterpret_cast<dvoid **>(&dt), OCI_DTYPE_TIMESTAMP,
+					                                 0, nullptr),
+					              ctx->errhp, "OCIDescriptorAlloc OCI_DTYPE_TIMESTAMP");
+					descriptors.push_back(dt);
+				}
+				memcpy(bind_arena.data() + bind_offsets[col_idx], descriptors.data(),
+				       MAX_BATCH_SIZE * sizeof(OCIDateTime *));
+				break;
+			}
+			case OracleWriteBindKind::TEXT:
+				if (type == "BLOB" || type == "RAW") {
+					bind_type = SQLT_LBI;
+				} else if (type == "CLOB") {
+					bind_type = SQLT_LNG;
+				}
+				break;
 			}
 
-			auto ctx = connection->Get();
-			CheckOCIError(OCIBindByPos(stmthp, &binds[col_idx], ctx->errhp, col_idx + 1, bind_buffers[col_idx].data(),
+			CheckOCIError(OCIBindByPos(stmthp, &binds[col_idx], ctx->errhp, col_idx + 1,
+			                           bind_arena.data() + bind_offsets[col_idx],
 			                           static_cast<sb4>(current_buffer_sizes[col_idx]), bind_type,
 			                           indicator_buffers[col_idx].data(), length_buffers[col_idx].data(), nullptr, 0,
 			                           nullptr, OCI_DEFAULT),
@@ -400,73 +1062,370 @@ void OracleWriteLocalState::Sink(DataChunk &chunk, const vector<string> &oracle_
 	}
 
 	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
-		BindColumn(chunk.data[col_idx], col_idx, count);
+		if (data.bind_kinds[col_idx] == OracleWriteBindKind::TEXT) {
+			BindColumn(*text_sources[col_idx], col_idx, count);
+		} else {
+			BindNativeColumn(chunk.data[col_idx], col_idx, count, data.bind_kinds[col_idx]);
+		}
+	}
+	if (getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] write batch: rows=%lu columns=%lu arena=%lu bytes\n", (unsigned long)count,
+		        (unsigned long)chunk.ColumnCount(), (unsigned long)bind_arena.size());
 	}
 
-	ExecuteBatch(count);
+	ExecuteBatch(chunk, data);
 }
 
-void OracleWriteLocalState::BindColumn(Vector &col, idx_t col_idx, idx_t count) {
+//! Oracle's 7-byte DATE: excess-100 century and year, month, day, and excess-1 hour, minute, second. Only AD years
+//! up to 9999 are encoded (as with the TO_DATE text path); BC years would wrap the bytes.
+static void EncodeOracleDate(int32_t year, int32_t month, int32_t day, int32_t hour, int32_t minute, int32_t second,
+                             ub1 *out) {
+	if (year < 1 || year > 9999) {
+		throw InvalidInputException("Oracle COPY: date with year %d is outside the supported Oracle DATE range "
+		                            "(years 1 to 9999)",
+		                            year);
+	}
+	out[0] = static_cast<ub1>(year / 100 + 100);
+	out[1] = static_cast<ub1>(year % 100 + 100);
+	out[2] = static_cast<ub1>(month);
+	out[3] = static_cast<ub1>(day);
+	out[4] = static_cast<ub1>(hour + 1);
+	out[5] = static_cast<ub1>(minute + 1);
+	out[6] = static_cast<ub1>(second + 1);
+}
+
+void OracleWriteSession::BindNativeColumn(Vector &col, idx_t col_idx, idx_t count, OracleWriteBindKind kind) {
+	auto ctx = connection->Get();
 	auto &validity = FlatVector::Validity(col);
-	auto &bind_buffer = bind_buffers[col_idx];
+	auto buffer = bind_arena.data() + bind_offsets[col_idx];
 	auto &indicators = indicator_buffers[col_idx];
 	auto &lengths = length_buffers[col_idx];
 	size_t element_size = current_buffer_sizes[col_idx];
+	auto &type = col.GetType();
 
 	for (idx_t i = 0; i < count; i++) {
 		if (!validity.RowIsValid(i)) {
 			indicators[i] = -1;
 			lengths[i] = 0;
-		} else {
-			indicators[i] = 0;
-			Value val = col.GetValue(i);
-			string str_val;
-
-			if (val.type().id() == LogicalTypeId::BLOB) {
-				str_val = StringValue::Get(val);
-			} else if (val.type().id() == LogicalTypeId::TIMESTAMP || val.type().id() == LogicalTypeId::DATE) {
-				// Default timestamp format matches Oracle's standard if we use TO_TIMESTAMP
-				// But DuckDB timestamp format is 'YYYY-MM-DD HH:MM:SS.MS'
-				// Oracle default input might expect T separator or not.
-				// But we use TO_DATE/TO_TIMESTAMP in SQL with format model.
-				// DuckDB::ToString() -> "2023-01-01 12:00:00.123"
-				// SQL -> TO_TIMESTAMP(:1, 'YYYY-MM-DD HH24:MI:SS.FF')
-				// This matches perfectly.
-				str_val = val.ToString();
+			continue;
+		}
+		indicators[i] = 0;
+		lengths[i] = static_cast<ub2>(OracleWriteBindSize(kind));
+		auto out = buffer + i * element_size;
+		switch (kind) {
+		case OracleWriteBindKind::INT64: {
+			int64_t value;
+			switch (type.id()) {
+			case LogicalTypeId::TINYINT:
+				value = FlatVector::GetData<int8_t>(col)[i];
+				break;
+			case LogicalTypeId::SMALLINT:
+				value = FlatVector::GetData<int16_t>(col)[i];
+				break;
+			case LogicalTypeId::INTEGER:
+				value = FlatVector::GetData<int32_t>(col)[i];
+				break;
+			case LogicalTypeId::UTINYINT:
+				value = FlatVector::GetData<uint8_t>(col)[i];
+				break;
+			case LogicalTypeId::USMALLINT:
+				value = FlatVector::GetData<uint16_t>(col)[i];
+				break;
+			case LogicalTypeId::UINTEGER:
+				value = FlatVector::GetData<uint32_t>(col)[i];
+				break;
+			default:
+				value = FlatVector::GetData<int64_t>(col)[i];
+				break;
+			}
+			memcpy(out, &value, sizeof(value));
+			break;
+		}
+		case OracleWriteBindKind::BOOLEAN: {
+			int64_t value = FlatVector::GetData<bool>(col)[i] ? 1 : 0;
+			memcpy(out, &value, sizeof(value));
+			break;
+		}
+		case OracleWriteBindKind::DOUBLE: {
+			double value = type.id() == LogicalTypeId::FLOAT ? FlatVector::GetData<float>(col)[i]
+			                                                 : FlatVector::GetData<double>(col)[i];
+			memcpy(out, &value, sizeof(value));
+			break;
+		}
+		case OracleWriteBindKind::NUMBER: {
+			// Unscaled decimal value into an OCINumber, then shifted by the scale (both local OCI calls).
+			int64_t unscaled;
+			switch (type.InternalType()) {
+			case PhysicalType::INT16:
+				unscaled = FlatVector::GetData<int16_t>(col)[i];
+				break;
+			case PhysicalType::INT32:
+				unscaled = FlatVector::GetData<int32_t>(col)[i];
+				break;
+			default:
+				unscaled = FlatVector::GetData<int64_t>(col)[i];
+				break;
+			}
+			auto number = reinterpret_cast<OCINumber *>(out);
+			CheckOCIError(OCINumberFromInt(ctx->errhp, &unscaled, sizeof(unscaled), OCI_NUMBER_SIGNED, number),
+			              ctx->errhp, "OCINumberFromInt");
+			CheckOCIError(OCINumberShift(ctx->errhp, number, -static_cast<sword>(DecimalType::GetScale(type)), number),
+			              ctx->errhp, "OCINumberShift");
+			break;
+		}
+		case OracleWriteBindKind::DATE: {
+			int32_t year, month, day, hour = 0, minute = 0, second = 0, micros = 0;
+			bool finite = type.id() == LogicalTypeId::DATE
+			                  ? Date::IsFinite(FlatVector::GetData<date_t>(col)[i])
+			                  : Timestamp::IsFinite(FlatVector::GetData<timestamp_t>(col)[i]);
+			if (!finite) {
+				throw InvalidInputException("Oracle COPY: infinite date is outside the supported Oracle DATE range");
+			}
+			if (type.id() == LogicalTypeId::DATE) {
+				Date::Convert(FlatVector::GetData<date_t>(col)[i], year, month, day);
 			} else {
-				str_val = val.ToString();
+				date_t date;
+				dtime_t time;
+				Timestamp::Convert(FlatVector::GetData<timestamp_t>(col)[i], date, time);
+				Date::Convert(date, year, month, day);
+				Time::Convert(time, hour, minute, second, micros);
 			}
-
-			if (getenv("ORACLE_DEBUG")) {
-				fprintf(stderr, "[oracle] BindColumn: col=%lu row=%lu type=%s str='%s'\n", (unsigned long)col_idx,
-				        (unsigned long)i, val.type().ToString().c_str(), str_val.c_str());
+			EncodeOracleDate(year, month, day, hour, minute, second, reinterpret_cast<ub1 *>(out));
+			break;
+		}
+		case OracleWriteBindKind::TIMESTAMP: {
+			int32_t year, month, day, hour, minute, second, micros;
+			auto value = FlatVector::GetData<timestamp_t>(col)[i];
+			if (!Timestamp::IsFinite(value)) {
+				throw InvalidInputException(
+				    "Oracle COPY: infinite timestamp is outside the supported Oracle TIMESTAMP range");
 			}
-
-			if (str_val.size() > element_size) {
-				throw IOException("Value too large for buffer");
+			date_t date;
+			dtime_t time;
+			Timestamp::Convert(value, date, time);
+			Date::Convert(date, year, month, day);
+			Time::Convert(time, hour, minute, second, micros);
+			// DuckDB counts 1 BC as year 0; Oracle has no year 0 and calls it -1.
+			if (year <= 0) {
+				year--;
+			}
+			if (year < -4712 || year > 9999) {
+				throw InvalidInputException("Oracle COPY: timestamp with year %d is outside the supported Oracle "
+				                            "TIMESTAMP range (years -4712 to 9999)",
+				                            year);
 			}
+			CheckOCIError(OCIDateTimeConstruct(ctx->envhp, ctx->errhp, timestamps[col_idx][i], static_cast<sb2>(year),
+			                                   static_cast<ub1>(month), static_cast<ub1>(day), static_cast<ub1>(hour),
+			                                   static_cast<ub1>(minute), static_cast<ub1>(second),
+			                                   static_cast<ub4>(micros) * 1000, nullptr, 0),
+			              ctx->errhp, "OCIDateTimeConstruct");
+			break;
+		}
+		case OracleWriteBindKind::TEXT:
+			throw InternalException("Oracle writer: text column bound natively");
+		}
+	}
+}
 
-			memcpy(bind_buffer.data() + (i * element_size), str_val.c_str(), str_val.size());
-			lengths[i] = static_cast<ub2>(str_val.size());
+void OracleWriteSession::BindColumn(Vector &strings, idx_t col_idx, idx_t count) {
+	auto &validity = FlatVector::Validity(strings);
+	auto values = FlatVector::GetData<string_t>(strings);
+	auto buffer = bind_arena.data() + bind_offsets[col_idx];
+	auto &indicators = indicator_buffers[col_idx];
+	auto &lengths = length_buffers[col_idx];
+	size_t element_size = current_buffer_sizes[col_idx];
+
+	for (idx_t i = 0; i < count; i++) {
+		if (!validity.RowIsValid(i)) {
+			indicators[i] = -1;
+			lengths[i] = 0;
+			continue;
 		}
+		indicators[i] = 0;
+		auto size = values[i].GetSize();
+		memcpy(buffer + i * element_size, values[i].GetData(), size);
+		lengths[i] = static_cast<ub2>(size);
 	}
 }
 
-void OracleWriteLocalState::ExecuteBatch(idx_t count) {
+void OracleWriteSession::ExecuteBatch(DataChunk &chunk, const OracleWriteBindData &data) {
 	auto ctx = connection->Get();
-	CheckOCIError(
-	    OCIStmtExecute(ctx->svchp, stmthp, ctx->errhp, static_cast<ub4>(count), 0, nullptr, nullptr, OCI_DEFAULT),
-	    ctx->errhp, "OCIStmtExecute Insert");
+	pending_rows = true;
+	// With a reject limit, rows Oracle rejects are reported per row instead of failing the whole batch.
+	ub4 mode = rejects.limit > 0 ? OCI_BATCH_ERRORS : OCI_DEFAULT;
+	auto status =
+	    OCIStmtExecute(ctx->svchp, stmthp, ctx->errhp, static_cast<ub4>(chunk.size()), 0, nullptr, nullptr, mode);
+	if (mode == OCI_BATCH_ERRORS && status == OCI_ERROR) {
+		sb4 errcode = 0;
+		OCIErrorGet(ctx->errhp, 1, nullptr, &errcode, nullptr, 0, OCI_HTYPE_ERROR);
+		if (errcode == 24381) { // ORA-24381: error(s) in array DML
+			status = OCI_SUCCESS_WITH_INFO;
+		}
+	}
+	CheckOCIError(status, ctx->errhp, "OCIStmtExecute Insert");
+	if (mode == OCI_BATCH_ERRORS) {
+		HandleRejects(chunk, data);
+	}
 }
 
-void OracleWriteLocalState::Flush() {
+//! JSON string literal for the ROW_DATA column of the reject table.
+static string RejectJsonQuote(const string &value) {
+	string result = "\"";
+	for (auto c : value) {
+		if (c == '"' || c == '\\') {
+			result += '\\';
+			result += c;
+		} else if (static_cast<unsigned char>(c) < 0x20) {
+			char escaped[8];
+			snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+			result += escaped;
+		} else {
+			result += c;
+		}
+	}
+	return result + "\"";
+}
+
+static string RejectedRowData(DataChunk &chunk, const OracleWriteBindData &data, idx_t row) {
+	string result = "{";
+	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+		if (col_idx > 0) {
+			result += ", ";
+		}
+		auto value = chunk.data[col_idx].GetValue(row);
+		result += RejectJsonQuote(data.column_names[col_idx]) + ": ";
+		result += value.IsNull() ? "null" : RejectJsonQuote(value.ToString());
+	}
+	result += "}";
+	// VARCHAR2(4000); cut on a UTF-8 character boundary
+	if (result.size() > 4000) {
+		idx_t cut = 4000;
+		while (cut > 0 && (static_cast<unsigned char>(result[cut]) & 0xC0) == 0x80) {
+			cut--;
+		}
+		result.resize(cut);
+	}
+	return result;
+}
+
+void OracleWriteSession::HandleRejects(DataChunk &chunk, const OracleWriteBindData &data) {
+	auto ctx = connection->Get();
+	ub4 error_count = 0;
+	OCIAttrGet(stmthp, OCI_HTYPE_STMT, &error_count, 0, OCI_ATTR_NUM_DML_ERRORS, ctx->errhp);
+	if (error_count == 0) {
+		return;
+	}
+	if (!row_errhp) {
+		CheckOCIError(OCIHandleAlloc(ctx->envhp, reinterpret_cast<dvoid **>(&row_errhp), OCI_HTYPE_ERROR, 0, nullptr),
+		              ctx->errhp, "OCIHandleAlloc row error handle");
+	}
+	if (!rejects.insert_sql.empty() && !reject_stmthp) {
+		CheckOCIError(OCIHandleAlloc(ctx->envhp, reinterpret_cast<dvoid **>(&reject_stmthp), OCI_HTYPE_STMT, 0,
+		                             nullptr),
+		              ctx->errhp, "OCIHandleAlloc reject stmthp");
+		CheckOCIError(OCIStmtPrepare(reject_stmthp, ctx->errhp, (OraText *)rejects.insert_sql.c_str(),
+		                             static_cast<ub4>(rejects.insert_sql.size()), OCI_NTV_SYNTAX, OCI_DEFAULT),
+		              ctx->errhp, "OCIStmtPrepare reject table insert");
+	}
+
+	string message;
+	// Columns of the reject table insert (target table, error code, message, row data), one entry per rejected row
+	vector<string> values[4];
+	for (ub4 i = 0; i < error_count; i++) {
+		CheckOCIError(OCIParamGet(ctx->errhp, OCI_HTYPE_ERROR, ctx->errhp, reinterpret_cast<dvoid **>(&row_errhp), i),
+		              ctx->errhp, "OCIParamGet batch error");
+		ub4 row_offset = 0;
+		OCIAttrGet(row_errhp, OCI_HTYPE_ERROR, &row_offset, 0, OCI_ATTR_DML_ROW_OFFSET, ctx->errhp);
+		text errbuf[512];
+		sb4 errcode = 0;
+		errbuf[0] = '\0';
+		OCIErrorGet(row_errhp, 1, nullptr, &errcode, errbuf, (ub4)sizeof(errbuf), OCI_HTYPE_ERROR);
+		message = string(reinterpret_cast<char *>(errbuf));
+		StringUtil::RTrim(message);
+		if (!reject_stmthp) {
+			continue;
+		}
+		values[0].push_back(data.table_name);
+		values[1].push_back(std::to_string(errcode));
+		values[2].push_back(message);
+		values[3].push_back(RejectedRowData(chunk, data, row_offset));
+	}
+	if (reject_stmthp) {
+		// All rejects of the batch go in one array insert. Recorded in this writer's transaction, so rejects are
+		// committed (or rolled back) with its rows.
+		vector<char> buffers[4];
+		vector<ub2> lengths[4];
+		for (idx_t v = 0; v < 4; v++) {
+			idx_t width = 1;
+			for (auto &value : values[v]) {
+				width = MaxValue<idx_t>(width, value.size());
+			}
+			buffers[v].assign(width * error_count, '\0');
+			lengths[v].resize(error_count);
+			for (idx_t r = 0; r < error_count; r++) {
+				memcpy(buffers[v].data() + r * width, values[v][r].data(), values[v][r].size());
+				lengths[v][r] = static_cast<ub2>(values[v][r].size());
+			}
+			OCIBind *bind = nullptr;
+			CheckOCIError(OCIBindByPos(reject_stmthp, &bind, ctx->errhp, v + 1, buffers[v].data(),
+			                           static_cast<sb4>(width), SQLT_CHR, nullptr, lengths[v].data(), nullptr, 0,
+			                           nullptr, OCI_DEFAULT),
+			              ctx->errhp, "OCIBindByPos reject table insert");
+		}
+		CheckOCIError(OCIStmtExecute(ctx->svchp, reject_stmthp, ctx->errhp, error_count, 0, nullptr, nullptr,
+		                             OCI_DEFAULT),
+		              ctx->errhp, "Failed to record rejected rows");
+	}
+
+	auto total = rejects.count += error_count;
+	if (getenv("ORACLE_DEBUG")) {
+		fprintf(stderr, "[oracle] write batch: %u rows rejected (%lu total), last: %s\n", (unsigned)error_count,
+		        (unsigned long)total, message.c_str());
+	}
+	if (total > rejects.limit) {
+		throw IOException("Oracle COPY rejected %d rows, more than REJECT_LIMIT %d; last error: %s",
+		                  static_cast<int64_t>(total), static_cast<int64_t>(rejects.limit), message);
+	}
+}
+
+void OracleWriteSession::Commit() {
+	auto ctx = connection->Get();
+	CheckOCIError(OCITransCommit(ctx->svchp, ctx->errhp, OCI_DEFAULT), ctx->errhp, "OCITransCommit");
+	pending_rows = false;
 }
 
 void OracleWriteFinalize(ClientContext &context, FunctionData &bind_data, GlobalFunctionData &gstate_p) {
 	auto &gstate = gstate_p.Cast<OracleWriteGlobalState>();
-	if (gstate.connection) {
+	auto &data = bind_data.Cast<OracleWriteBindData>();
+	if (data.direct_path) {
+		// Finishing saves each stream's data; there is no transaction to commit.
+		lock_guard<std::mutex> guard(gstate.load_lock);
+		for (auto &loader : gstate.loaders) {
+			loader->Wait();
+		}
+		for (auto &loader : gstate.loaders) {
+			loader->Finish();
+		}
+		return;
+	}
+	lock_guard<std::mutex> guard(gstate.writer_lock);
+	for (auto &writer : gstate.writers) {
+		// Slots stay empty when the COPY had fewer local states than writers.
+		if (writer) {
+			writer->Commit();
+		}
+	}
+	if (!gstate.staging_table.empty()) {
+		// All writers made it: move the rows into the target in a single transaction.
 		auto ctx = gstate.connection->Get();
+		auto columns = QuotedColumnList(data);
+		ExecuteStatement(*ctx,
+		                 "INSERT /*+ APPEND */ INTO " + QuotedTarget(data, data.object_name) + " (" + columns +
+		                     ") SELECT " + columns + " FROM " + gstate.staging_table,
+		                 "merge staging table");
 		CheckOCIError(OCITransCommit(ctx->svchp, ctx->errhp, OCI_DEFAULT), ctx->errhp, "OCITransCommit");
+		ExecuteStatement(*ctx, "DROP TABLE " + gstate.staging_table + " PURGE", "drop staging table");
+		gstate.staging_table.clear();
 	}
 }
 